@@ -1,8 +1,11 @@
 #include "cmag_core/core/version.h"
 #include "cmag_core/dumper/cmag_dumper.h"
 #include "cmag_core/dumper/dumper_argument_parser.h"
+#include "cmag_core/parse/cmag_project_file.h"
 #include "cmag_core/utils/error.h"
 
+#include <fstream>
+
 #define RETURN_ERROR(expr)                \
     do {                                  \
         const CmagResult r = (expr);      \
@@ -11,6 +14,32 @@
         }                                 \
     } while (false)
 
+static CmagResult convertProjectFile(const fs::path &inputPath) {
+    CmagProject project = {};
+    CmagProjectFormat inputFormat = {};
+    const ParseResult parseResult = CmagProjectFile::readProject(inputPath, project, &inputFormat);
+    if (parseResult.status != ParseResultStatus::Success) {
+        LOG_ERROR("could not parse project file ", inputPath.string(), ". ", parseResult.errorMessage);
+        return parseResult.status == ParseResultStatus::FileAccessError ? CmagResult::FileAccessError : CmagResult::JsonParseError;
+    }
+
+    const CmagProjectFormat outputFormat = CmagProjectFile::getOtherFormat(inputFormat);
+    const fs::path outputPath = CmagProjectFile::getPathForFormat(inputPath, outputFormat);
+    std::ofstream outFile{outputPath, CmagProjectFile::getOpenMode(outputFormat)};
+    if (!outFile) {
+        LOG_ERROR("failed to open ", outputPath.string());
+        return CmagResult::FileAccessError;
+    }
+    CmagProjectFile::writeProject(project, outFile, outputFormat);
+    if (!outFile) {
+        LOG_ERROR("failed to write to ", outputPath.string());
+        return CmagResult::FileAccessError;
+    }
+
+    LOG_INFO("Successfully converted project file to ", outputPath.string());
+    return CmagResult::Success;
+}
+
 int main(int argc, const char **argv) {
     // Parse arguments
     DumperArgumentParser argParser{argc, argv};
@@ -22,6 +51,10 @@ int main(int argc, const char **argv) {
         argParser.printHelp();
         return 1;
     }
+    if (!argParser.getConvertPath().empty()) {
+        RETURN_ERROR(convertProjectFile(argParser.getConvertPath()));
+        return 0;
+    }
     const fs::path &sourcePath = argParser.getSourcePath();
     if (sourcePath.empty()) {
         LOG_ERROR("empty source dir.\n");
@@ -44,7 +77,7 @@ int main(int argc, const char **argv) {
         argParser.getExtraTargetProperties(),
     };
     RETURN_ERROR(dumper.dump());
-    RETURN_ERROR(dumper.writeProjectToFile());
+    RETURN_ERROR(dumper.writeProjectToFile(argParser.getBinaryProject() ? CmagProjectFormat::Binary : CmagProjectFormat::Json));
     if (!argParser.getJsonDebug()) {
         RETURN_ERROR(dumper.cleanupTemporaryFiles());
     }
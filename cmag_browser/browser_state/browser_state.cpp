@@ -1,9 +1,9 @@
 #include "cmag_browser/browser_state/browser_state.h"
 
-BrowserState::BrowserState(const CmagBrowserTheme &theme, const fs::path &projectFilePath, CmagProject &project)
+BrowserState::BrowserState(const CmagBrowserTheme &theme, const fs::path &projectFilePath, CmagProjectFormat projectFileFormat, CmagProject &project)
     : theme(theme),
       project(project),
       configSelector(theme, project, projectSaver),
       targetSelection(project),
       tabChange(*this),
-      projectSaver(project, projectFilePath, 2000) {}
+      projectSaver(project, projectFilePath, projectFileFormat, 2000) {}
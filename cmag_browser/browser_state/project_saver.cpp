@@ -1,23 +1,41 @@
 #include "project_saver.h"
 
-#include "cmag_core/parse/cmag_json_writer.h"
 #include "cmag_core/utils/error.h"
 
+#include <algorithm>
 #include <fstream>
 #include <imgui/imgui.h>
 
-ProjectSaver::ProjectSaver(CmagProject &project, const fs::path &outputPath, size_t autoSaveIntervalMilliseconds)
+ProjectSaver::ProjectSaver(CmagProject &project, const fs::path &outputPath, CmagProjectFormat outputFormat, size_t autoSaveIntervalMilliseconds)
     : project(project),
       outputPath(outputPath),
+      outputFormat(outputFormat),
       lastSaveTime(Clock::now()),
-      autoSaveInterval(std::chrono::milliseconds(autoSaveIntervalMilliseconds)) {}
+      autoSaveInterval(std::chrono::milliseconds(autoSaveIntervalMilliseconds)),
+      journal(outputPath),
+      fullSaveRequired(project.getGlobals().browser.needsLayout),
+      workerThread(&ProjectSaver::saveWorkerMain, this) {}
+
+ProjectSaver::~ProjectSaver() {
+    // Worker finishes all pending saves before exiting
+    {
+        std::lock_guard lock{worker.mutex};
+        worker.stop = true;
+    }
+    worker.condition.notify_one();
+    workerThread.join();
+    handleFinishedSave();
+}
 
 void ProjectSaver::tryAutoSave(size_t frameIndex) {
+    handleFinishedSave();
+
     if (frameIndex < 3) {
         // During the first few frames it is possible to set some unneeded dirty flags, because ImGui may have some delays
         // and cause ping-ponging between states. For example this happens when forcing selected tab in tab bar. The request
         // is honored only in second frame. With this workaround we hide this and avoid unneeded calls to save().
         dirtyState = ProjectDirtyFlag::None;
+        movedTargets.clear();
         return;
     }
 
@@ -33,7 +51,7 @@ void ProjectSaver::tryAutoSave(size_t frameIndex) {
         return;
     }
 
-    save();
+    saveToJournal();
 }
 
 void ProjectSaver::trySaveFromKeyboardShortcut() {
@@ -46,23 +64,153 @@ void ProjectSaver::makeDirty(ProjectDirtyFlag flag) {
     dirtyState = dirtyState | flag;
 }
 
+void ProjectSaver::makeTargetMoved(const CmagTarget &target) {
+    movedTargets.push_back(&target);
+    makeDirty(ProjectDirtyFlag::NodePosition);
+}
+
 void ProjectSaver::save() {
     lastSaveTime = Clock::now();
 
+    {
+        std::lock_guard lock{worker.mutex};
+        worker.pendingSnapshot = project.createBrowserStateSnapshot();
+    }
+    worker.condition.notify_one();
+    saveInProgress = true;
+
+    // Clear dirty flag, but remember the changes until the snapshot is written
+    unsavedDirtyState = unsavedDirtyState | dirtyState;
+    unsavedMovedTargets.insert(unsavedMovedTargets.end(), movedTargets.begin(), movedTargets.end());
+    dirtyState = ProjectDirtyFlag::None;
+    movedTargets.clear();
+}
+
+void ProjectSaver::compactJournal() {
+    handleFinishedSave();
+    if (!saveInProgress && journal.getFileSize() > 0) {
+        save();
+    }
+}
+
+void ProjectSaver::saveToJournal() {
+    if (saveInProgress) {
+        // Journal will be removed after the save finishes. Keep the dirty flags and retry later.
+        return;
+    }
+    if (fullSaveRequired || journal.getFileSize() >= journalCompactionThreshold) {
+        save();
+        return;
+    }
+
+    lastSaveTime = Clock::now();
+
+    const CmagGlobals &globals = project.getGlobals();
+    if (hasProjectDirtyFlagBit(dirtyState, ProjectDirtyFlag::NodePosition)) {
+        std::sort(movedTargets.begin(), movedTargets.end());
+        movedTargets.erase(std::unique(movedTargets.begin(), movedTargets.end()), movedTargets.end());
+        for (const CmagTarget *target : movedTargets) {
+            journal.recordTargetPosition(*target);
+        }
+    }
+    if (hasProjectDirtyFlagBit(dirtyState, ProjectDirtyFlag::CameraPosition)) {
+        journal.recordCamera(globals.browser);
+    }
+    if (hasProjectDirtyFlagBit(dirtyState, ProjectDirtyFlag::SelectedConfig)) {
+        journal.recordSelectedConfig(globals);
+    }
+    if (hasProjectDirtyFlagBit(dirtyState, ProjectDirtyFlag::SelectedTab)) {
+        journal.recordSelectedTab(globals.browser);
+    }
+    if (hasProjectDirtyFlagBit(dirtyState, ProjectDirtyFlag::SelectedDependencies)) {
+        journal.recordDisplayedDependencyType(globals.browser);
+    }
+    if (hasProjectDirtyFlagBit(dirtyState, ProjectDirtyFlag::SelectedTarget)) {
+        journal.recordSelectedTarget(globals.browser);
+    }
+
+    if (!journal.flush()) {
+        LOG_WARNING("Failed writing project journal. Saving the whole project.");
+        save();
+        return;
+    }
+
+    // Clear dirty flag
+    dirtyState = ProjectDirtyFlag::None;
+    movedTargets.clear();
+}
+
+void ProjectSaver::handleFinishedSave() {
+    std::optional<bool> result = {};
+    bool lastSaveResult = false;
+    {
+        std::lock_guard lock{worker.mutex};
+        std::swap(result, worker.finishedSaveResult);
+        lastSaveResult = worker.lastSaveResult;
+        lastSaveDurationMilliseconds = worker.lastSaveDurationMilliseconds;
+        saveInProgress = worker.busy || worker.pendingSnapshot.has_value();
+    }
+    if (!result.has_value()) {
+        return;
+    }
+
+    // Journal is not written during saves, so any successful save contains all of its changes.
+    if (result.value()) {
+        journal.reset();
+        fullSaveRequired = false;
+    }
+
+    // Snapshots contain the whole state, so once the newest one is handled, its result decides for all the changes.
+    if (!saveInProgress) {
+        if (!lastSaveResult) {
+            dirtyState = dirtyState | unsavedDirtyState;
+            movedTargets.insert(movedTargets.end(), unsavedMovedTargets.begin(), unsavedMovedTargets.end());
+        }
+        unsavedDirtyState = ProjectDirtyFlag::None;
+        unsavedMovedTargets.clear();
+    }
+}
+
+void ProjectSaver::saveWorkerMain() {
+    std::unique_lock lock{worker.mutex};
+    while (true) {
+        worker.condition.wait(lock, [this]() { return worker.stop || worker.pendingSnapshot.has_value(); });
+        if (!worker.pendingSnapshot.has_value()) {
+            return;
+        }
+
+        const CmagBrowserStateSnapshot snapshot = std::move(worker.pendingSnapshot.value());
+        worker.pendingSnapshot.reset();
+        worker.busy = true;
+        lock.unlock();
+
+        const auto startTime = Clock::now();
+        const bool success = writeProject(snapshot);
+        const std::chrono::duration<float, std::milli> duration = Clock::now() - startTime;
+
+        lock.lock();
+        worker.busy = false;
+        worker.lastSaveDurationMilliseconds = duration.count();
+        worker.finishedSaveResult = worker.finishedSaveResult.value_or(false) || success;
+        worker.lastSaveResult = success;
+    }
+}
+
+bool ProjectSaver::writeProject(const CmagBrowserStateSnapshot &snapshot) const {
     // Open file
     fs::path tmpOutputPath = outputPath;
     tmpOutputPath.replace_extension(outputPath.extension().string() + ".save");
-    std::ofstream file{tmpOutputPath};
+    std::ofstream file{tmpOutputPath, CmagProjectFile::getOpenMode(outputFormat)};
     if (!file) {
         LOG_WARNING("Failed to open file ", tmpOutputPath.string(), " for saving the project.");
-        return;
+        return false;
     }
 
     // Write project
-    CmagJsonWriter::writeProject(project, file);
+    CmagProjectFile::writeProject(project, snapshot, file, outputFormat);
     if (!file) {
         LOG_WARNING("Failed saving the project.");
-        return;
+        return false;
     }
     file.close();
 
@@ -71,10 +219,9 @@ void ProjectSaver::save() {
     fs::rename(tmpOutputPath, outputPath, renameError);
     if (renameError) {
         LOG_WARNING("Failed saving the project to original path. Project saved to ", tmpOutputPath, " - a backup path.");
+        return false;
     }
-
-    // Clear dirty flag
-    dirtyState = ProjectDirtyFlag::None;
+    return true;
 }
 
 bool ProjectSaver::isDirty() const {
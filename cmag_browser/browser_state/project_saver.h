@@ -1,11 +1,16 @@
 #pragma once
 
+#include "cmag_core/browser/project_journal.h"
+#include "cmag_core/parse/cmag_project_file.h"
 #include "cmag_core/utils/enum_utils.h"
 #include "cmag_core/utils/filesystem.h"
 
 #include <chrono>
-
-class CmagProject;
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
 
 enum class ProjectDirtyFlag {
     None = 0,
@@ -21,25 +26,68 @@ BITFIELD_ENUM(ProjectDirtyFlag)
 
 class ProjectSaver {
 public:
-    ProjectSaver(CmagProject &project, const fs::path &outputPath, size_t autoSaveIntervalMilliseconds);
+    ProjectSaver(CmagProject &project, const fs::path &outputPath, CmagProjectFormat outputFormat, size_t autoSaveIntervalMilliseconds);
+    ~ProjectSaver();
+    ProjectSaver(const ProjectSaver &) = delete;
+    ProjectSaver &operator=(const ProjectSaver &) = delete;
 
     void tryAutoSave(size_t frameIndex);
     void trySaveFromKeyboardShortcut();
     void makeDirty(ProjectDirtyFlag flag);
+    void makeTargetMoved(const CmagTarget &target);
     void save();
+    void compactJournal();
 
     bool isDirty() const;
     bool shouldShowDirtyNotification() const;
+    bool isSaveInProgress() const { return saveInProgress; }
+    float getLastSaveDurationMilliseconds() const { return lastSaveDurationMilliseconds; }
     const auto &getOutputPath() const { return outputPath; }
 
 private:
+    void saveToJournal();
+    void handleFinishedSave();
+    void saveWorkerMain();
+    bool writeProject(const CmagBrowserStateSnapshot &snapshot) const;
+
     using Clock = std::chrono::steady_clock;
     CmagProject &project;
     const fs::path outputPath;
+    const CmagProjectFormat outputFormat;
     Clock::time_point lastSaveTime;
     const Clock::duration autoSaveInterval;
     ProjectDirtyFlag dirtyState = ProjectDirtyFlag::None;
 
+    // Autosave only appends changes to a journal. Whole project is written on manual save, when the journal grows too
+    // big, or when the browser is closed. Projects which haven't been laid out yet, must be written whole at least once.
+    ProjectJournal journal;
+    std::vector<const CmagTarget *> movedTargets = {};
+    bool fullSaveRequired = false;
+
+    // Changes included in snapshots, which haven't been written yet. If writing fails, they become dirty again,
+    // so they're not lost and the next autosave retries.
+    ProjectDirtyFlag unsavedDirtyState = ProjectDirtyFlag::None;
+    std::vector<const CmagTarget *> unsavedMovedTargets = {};
+    constexpr static inline size_t journalCompactionThreshold = 1024 * 1024;
+
+    // Whole project is written on a worker thread, so the UI doesn't stall on big projects. Main thread only takes a
+    // snapshot of the data modified by the browser. If another save is requested while the worker is busy, the newest
+    // snapshot replaces the one waiting in the queue. Journal is not touched until the worker is done, because it's
+    // removed after a successful save.
+    struct {
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::optional<CmagBrowserStateSnapshot> pendingSnapshot;
+        std::optional<bool> finishedSaveResult; // consumed by the main thread, true if any of the finished saves succeeded
+        bool lastSaveResult = false;            // result of the most recently finished save
+        float lastSaveDurationMilliseconds = 0;
+        bool busy = false;
+        bool stop = false;
+    } worker;
+    std::thread workerThread;
+    bool saveInProgress = false;
+    float lastSaveDurationMilliseconds = 0;
+
     constexpr static inline ProjectDirtyFlag dirtyMaskAutoSave =
         ProjectDirtyFlag::NodePosition |
         ProjectDirtyFlag::CameraPosition |
@@ -7,9 +7,9 @@
 #include "cmag_browser/tabs/target_graph_tab.h"
 #include "cmag_browser/ui_utils/imgui_font_glyph_inserter.h"
 #include "cmag_core/browser/browser_argument_parser.h"
+#include "cmag_core/browser/project_journal.h"
 #include "cmag_core/core/version.h"
-#include "cmag_core/parse/cmag_json_parser.h"
-#include "cmag_core/utils/file_utils.h"
+#include "cmag_core/parse/cmag_project_file.h"
 #include "cmag_core/utils/string_utils.h"
 
 #include <GLFW/glfw3.h> // Will drag system OpenGL headers
@@ -91,17 +91,18 @@ int main(int argc, const char **argv) {
     }
 
     // Load cmag project
-    const auto cmagProjectJson = readFile(argParser.getProjectFilePath());
-    if (!cmagProjectJson.has_value()) {
+    CmagProject cmagProject = {};
+    CmagProjectFormat cmagProjectFormat = {};
+    const ParseResult projectParseResult = CmagProjectFile::readProject(argParser.getProjectFilePath(), cmagProject, &cmagProjectFormat, true);
+    if (projectParseResult.status == ParseResultStatus::FileAccessError) {
         LOG_ERROR("could not read project file ", argParser.getProjectFilePath());
         return 1;
     }
-    CmagProject cmagProject = {};
-    const ParseResult projectParseResult = CmagJsonParser::parseProject(cmagProjectJson.value(), cmagProject);
     if (projectParseResult.status != ParseResultStatus::Success) {
         LOG_ERROR("could not parse project file ", argParser.getProjectFilePath(), ". ", projectParseResult.errorMessage);
         return 1;
     }
+    ProjectJournal::replay(argParser.getProjectFilePath(), cmagProject);
 
     // Init OpenGL
     const char *glslVersion = {};
@@ -138,7 +139,7 @@ int main(int argc, const char **argv) {
 
     // Init browser components
     CmagBrowserTheme theme = CmagBrowserTheme::createDarkTheme();
-    BrowserState browserState{theme, argParser.getProjectFilePath(), cmagProject};
+    BrowserState browserState{theme, argParser.getProjectFilePath(), cmagProjectFormat, cmagProject};
 
     TargetGraphTab targetGraphTab{browserState, argParser.getShowDebugWidgets()};
     ListDirTab listFileTab{browserState};
@@ -208,6 +209,7 @@ int main(int argc, const char **argv) {
     }
 
     // Cleanup
+    browserState.getProjectSaver().compactJournal();
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
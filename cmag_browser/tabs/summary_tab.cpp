@@ -6,7 +6,9 @@
 
 SummaryTab::SummaryTab(BrowserState &browser)
     : browser(browser),
-      compiler(createCompilerString(browser.getProject().getGlobals())) {
+      compiler(createCompilerString(browser.getProject().getGlobals())),
+      unmatchedDependenciesCount(std::to_string(browser.getProject().getUnmatchedDependencies().size())),
+      unmatchedDependenciesTooltip(createUnmatchedDependenciesTooltip(browser.getProject())) {
 }
 
 void SummaryTab::render() {
@@ -24,6 +26,7 @@ void SummaryTab::render() {
         renderRowConfigSelector();
         renderRowString("CMake project name", globals.cmakeProjectName, "Name of the CMake project set by project() command in the root level CMakeLists.txt. More info at:", "https://cmake.org/cmake/help/latest/command/project.html");
         renderRowString("CMake generator", globals.generator, "CMake generation used to generate this project. Generators can be thought of as a compiler/build system selectors. More info at:", "https://cmake.org/cmake/help/latest/manual/cmake-generators.7.html");
+        renderRowString("Unmatched dependencies", unmatchedDependenciesCount, unmatchedDependenciesTooltip.c_str());
     }
     {
         Section section = renderSectionHeader("Cmag configuration", "Metadata cmag dumper that created this project.");
@@ -135,3 +138,34 @@ void SummaryTab::renderRowAutoSave() {
 std::string SummaryTab::createCompilerString(const CmagGlobals &globals) {
     return globals.compilerId + " " + globals.compilerVersion;
 }
+
+std::string SummaryTab::createUnmatchedDependenciesTooltip(const CmagProject &project) {
+    std::string result = "Dependencies, which could not be matched with any target of the project. They are passed to the second "
+                         "CMake pass to detect targets invisible to cmag, like imported targets or aliases.";
+
+    const auto &unmatchedDependencies = project.getUnmatchedDependencies();
+    if (unmatchedDependencies.empty()) {
+        return result;
+    }
+
+    // Long lists would not fit on the screen, so only show the first few.
+    constexpr size_t maxDependenciesToShow = 20;
+    result += "\n";
+    for (size_t dependencyIndex = 0; dependencyIndex < unmatchedDependencies.size(); dependencyIndex++) {
+        if (dependencyIndex == maxDependenciesToShow) {
+            result += "\n... and " + std::to_string(unmatchedDependencies.size() - maxDependenciesToShow) + " more";
+            break;
+        }
+
+        const std::string &dependency = unmatchedDependencies[dependencyIndex];
+        result += "\n" + dependency + " - referenced by ";
+        const std::vector<size_t> *targetIndices = project.findUnmatchedDependencyTargetIndices(dependency);
+        for (size_t i = 0; i < targetIndices->size(); i++) {
+            if (i > 0) {
+                result += ", ";
+            }
+            result += project.getTargets()[(*targetIndices)[i]].name;
+        }
+    }
+    return result;
+}
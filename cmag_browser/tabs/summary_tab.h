@@ -6,6 +6,7 @@
 #include <string>
 
 struct CmagGlobals;
+class CmagProject;
 
 struct Section;
 
@@ -24,10 +25,13 @@ private:
     void renderRowAutoSave();
 
     static std::string createCompilerString(const CmagGlobals &globals);
+    static std::string createUnmatchedDependenciesTooltip(const CmagProject &project);
 
     const float sectionIndentSize = 8.f;
     const float marginBetweenSections = 15.f;
     BrowserState &browser;
     std::string compiler;
+    std::string unmatchedDependenciesCount;
+    std::string unmatchedDependenciesTooltip;
     float firstColumnWidth = 0;
 };
@@ -54,6 +54,9 @@ void TargetGraphTab::renderSidePaneSectionDebug() {
     renderSidePaneSlider("arrow length", 1, 15, targetGraph.getArrowLengthScalePtr());
     renderSidePaneSlider("arrow width", 1, 15, targetGraph.getArrowWidthScalePtr());
     renderSidePaneSlider("stipple", 0.005f, 0.1f, targetGraph.getLineStippleScalePtr());
+
+    const ProjectSaver &saver = browser.getProjectSaver();
+    ImGui::Text("Last save: %.2f ms%s", saver.getLastSaveDurationMilliseconds(), saver.isSaveInProgress() ? " (saving)" : "");
 }
 
 void TargetGraphTab::renderSidePaneSectionView() {
@@ -100,10 +103,83 @@ void TargetGraphTab::renderSidePaneSectionTarget() {
         .addText("Hide all connections between this target and other targets on graph. Useful to avoid clutter.")
         .execute();
 
+    renderSidePaneTargetDependents(*target);
     renderPropertyPopup();
     renderPropertyTable(target);
 }
 
+void TargetGraphTab::renderSidePaneTargetDependents(const CmagTarget &target) {
+    const std::string_view config = browser.getConfigSelector().getCurrentConfig();
+    const CmagDependencyType types = browser.getProject().getGlobals().browser.displayedDependencyType;
+    if (dependents.target != &target || dependents.config != config || dependents.types != types) {
+        refreshTargetDependents(target, config, types);
+    }
+
+    ImGui::Text("%s", dependents.directText.c_str());
+    TooltipBuilder(browser.getTheme())
+        .setHoverLastItem()
+        .addText("Targets directly depending on this target with currently displayed dependency types.")
+        .addText(dependents.directTooltip.c_str())
+        .execute();
+
+    ImGui::Text("%s", dependents.transitiveText.c_str());
+    TooltipBuilder(browser.getTheme())
+        .setHoverLastItem()
+        .addText("Targets directly or indirectly depending on this target with currently displayed dependency types. They are affected by changes to this target.")
+        .addText(dependents.transitiveTooltip.c_str())
+        .execute();
+
+    if (!dependents.cycleText.empty()) {
+        ImGui::Text("%s", dependents.cycleText.c_str());
+        TooltipBuilder(browser.getTheme())
+            .setHoverLastItem()
+            .addText("Targets in a dependency cycle with this target. CMake allows cycles between static libraries. They are placed next to each other on the graph.")
+            .addText(dependents.cycleTooltip.c_str())
+            .execute();
+    }
+}
+
+void TargetGraphTab::refreshTargetDependents(const CmagTarget &target, std::string_view config, CmagDependencyType types) {
+    dependents.target = &target;
+    dependents.config = std::string{config};
+    dependents.types = types;
+
+    const CmagProject &project = browser.getProject();
+    const CmagDependencyGraph *graph = project.findDependencyGraph(config);
+    const CmagDependencyComponents *components = project.getDependencyComponents(config, types);
+    std::vector<uint32_t> directIndices = {};
+    std::vector<uint32_t> transitiveIndices = {};
+    std::vector<uint32_t> cycleIndices = {};
+    if (graph != nullptr && components != nullptr) {
+        const auto targetIndex = static_cast<size_t>(&target - project.getTargets().data());
+        graph->collectDependents(targetIndex, types, directIndices);
+        graph->collectTransitiveDependents(targetIndex, types, transitiveIndices);
+        if (components->isTargetInCycle(targetIndex)) {
+            const CmagDependencyComponents::IndexRange cycle = components->getComponentTargets(components->getComponent(targetIndex));
+            cycleIndices.assign(cycle.begin(), cycle.end());
+        }
+    }
+
+    auto createTooltip = [&](const std::vector<uint32_t> &targetIndices) {
+        // Long lists would not fit on the screen, so only show the first few.
+        constexpr size_t maxTargetsToShow = 20;
+        std::string result = {};
+        for (size_t i = 0; i < targetIndices.size() && i < maxTargetsToShow; i++) {
+            result += (i > 0 ? "\n" : "") + project.getTargets()[targetIndices[i]].name;
+        }
+        if (targetIndices.size() > maxTargetsToShow) {
+            result += "\n... and " + std::to_string(targetIndices.size() - maxTargetsToShow) + " more";
+        }
+        return result;
+    };
+    dependents.directText = "Direct dependents: " + std::to_string(directIndices.size());
+    dependents.directTooltip = createTooltip(directIndices);
+    dependents.transitiveText = "Rebuild impact: " + std::to_string(transitiveIndices.size());
+    dependents.transitiveTooltip = createTooltip(transitiveIndices);
+    dependents.cycleText = cycleIndices.empty() ? "" : "Dependency cycle: " + std::to_string(cycleIndices.size());
+    dependents.cycleTooltip = createTooltip(cycleIndices);
+}
+
 void TargetGraphTab::renderSidePaneSlider(const char *label, float min, float max, float *value) {
     const float textWidth = ImGui::GetStyle().ItemInnerSpacing.x + ImGui::CalcTextSize(label).x;
     std::string labelHidden = std::string("##");
@@ -183,7 +259,7 @@ void TargetGraphTab::renderPropertyPopup() {
         ImVec2(0, 0),
         ImVec2(displaySize.x / 2, displaySize.y / 2));
     if (ImGui::BeginPopup(popupName)) {
-        ImGui::Text("Property %s", popup.property->name.c_str());
+        ImGui::Text("Property %.*s", static_cast<int>(popup.property->name.size()), popup.property->name.data());
 
         for (const auto &entry : popup.propertyValueList) {
             FORMAT_STRING(buffer, "  %.*s\n", static_cast<int>(entry.length()), entry.data());
@@ -205,7 +281,6 @@ void TargetGraphTab::renderPropertyTable(const CmagTarget *selectedTarget) {
     auto tableStyle = theme.setupPropertyTable();
     if (ImGui::BeginTable("Table populating", 2, tableFlags, propertyTableSize)) {
         const CmagTargetConfig *config = selectedTarget->tryGetConfig(browser.getConfigSelector().getCurrentConfig());
-
         for (const CmagTargetProperty &property : config->properties) {
             ImGui::TableNextRow();
             ImGui::TableNextColumn();
@@ -216,8 +291,8 @@ void TargetGraphTab::renderPropertyTable(const CmagTarget *selectedTarget) {
                 renderPropertyTablePopup(property, cellMin, cellMax, false);
                 scheduleOpenPropertyPopupOnClick(property, cellMin, cellMax);
 
-                auto nameStyle = theme.setupPropertyName(property.value.empty(), property.isConsistent);
-                ImGui::Text("%s", property.name.c_str());
+                auto nameStyle = theme.setupPropertyName(property.getValue().empty(), property.isConsistent);
+                ImGui::TextUnformatted(property.name.data(), property.name.data() + property.name.size());
             }
 
             ImGui::TableNextColumn();
@@ -228,8 +303,10 @@ void TargetGraphTab::renderPropertyTable(const CmagTarget *selectedTarget) {
                 renderPropertyTablePopup(property, cellMin, cellMax, true);
                 scheduleOpenPropertyPopupOnClick(property, cellMin, cellMax);
 
+                // Values are views, which are not zero-terminated.
+                const std::string_view value = property.getValue();
                 auto valueStyle = theme.setupPropertyValue();
-                ImGui::Text("%s", property.value.c_str());
+                ImGui::TextUnformatted(value.data(), value.data() + value.size());
             }
         }
 
@@ -241,7 +318,7 @@ void TargetGraphTab::renderPropertyTablePopup(const CmagTargetProperty &property
     const CmagBrowserTheme &theme = browser.getTheme();
     TooltipBuilder(theme)
         .setHoverRect(cellMin, cellMax)
-        .addTextOneLine(showValue ? property.value.c_str() : property.name.c_str())
+        .addTextOneLine(showValue ? property.getValue() : property.name)
         .hideWhenPopupsAreVisible()
         .execute([&]() {
             auto popupStyle = theme.setupPopup();
@@ -332,9 +409,6 @@ void TargetGraphTab::scheduleOpenPropertyPopupOnClick(const CmagTargetProperty &
         popup.shouldBeOpen = true;
         popup.isOpen = false;
         popup.property = &property;
-        popup.propertyValueList = splitCmakeListString(property.value, true);
-        if (popup.propertyValueList.empty() && !popup.property->value.empty()) {
-            popup.propertyValueList.push_back(popup.property->value);
-        }
+        popup.propertyValueList = iterateCmakeListString(property.getValue(), false); // values which aren't lists are a single entry
     }
 }
@@ -2,6 +2,7 @@
 
 #include "cmag_browser/browser_state/browser_state.h"
 #include "cmag_browser/target_graph/target_graph.h"
+#include "cmag_core/utils/string_utils.h"
 
 #include <imgui/imgui.h>
 
@@ -19,6 +20,8 @@ private:
 
     void renderSidePaneSlider(const char *label, float min, float max, float *value);
     void renderSidePaneDependencyTypeSelection();
+    void renderSidePaneTargetDependents(const CmagTarget &target);
+    void refreshTargetDependents(const CmagTarget &target, std::string_view config, CmagDependencyType types);
 
     void renderPropertyPopup();
     void renderPropertyTable(const CmagTarget *selectedTarget);
@@ -41,6 +44,20 @@ private:
         bool shouldBeOpen = false;
         bool isOpen = false;
         const CmagTargetProperty *property = nullptr;
-        std::vector<std::string_view> propertyValueList;
+        StringSplitRange propertyValueList;
     } popup;
+
+    // Dependents of the selected target are only recalculated when the selection, config or displayed dependency
+    // types change.
+    struct {
+        const CmagTarget *target = nullptr;
+        std::string config = {};
+        CmagDependencyType types = CmagDependencyType::NONE;
+        std::string directText = {};
+        std::string directTooltip = {};
+        std::string transitiveText = {};
+        std::string transitiveTooltip = {};
+        std::string cycleText = {};
+        std::string cycleTooltip = {};
+    } dependents;
 };
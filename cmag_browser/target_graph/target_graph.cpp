@@ -143,8 +143,8 @@ void TargetGraph::update(ImGuiIO &io) {
     }
     if (io.MouseReleased[ImGuiMouseButton_Left]) {
         if (targetDrag.active) {
+            browser.getProjectSaver().makeTargetMoved(*targetDrag.draggedTarget);
             targetDrag.end();
-            browser.getProjectSaver().makeDirty(ProjectDirtyFlag::NodePosition);
         }
         if (camera.dragActive) {
             camera.endDrag(browser.getProject().getGlobals().browser);
@@ -296,7 +296,7 @@ void TargetGraph::calculateWorldSpaceVerticesForTarget(const CmagTarget &target,
 }
 
 void TargetGraph::refreshConnections() {
-    connections.updateTopology(targets, cmakeConfig);
+    connections.updateTopology(browser.getProject(), targets, cmakeConfig);
     connections.update(displayedDependencyType, shapes, arrowLengthScale, arrowWidthScale, lineStippleScale, focusedTarget, browser.getTargetSelection().getSelection());
 }
 
@@ -338,7 +338,7 @@ void TargetGraph::resetGraphLayout() {
     const auto worldSpaceNodeWidth = static_cast<size_t>(shapes.maxWidth * nodeScale);
     const auto worldSpaceNodeHeight = static_cast<size_t>(shapes.maxHeight * nodeScale);
 
-    calculateLayout(targets, cmakeConfig, worldSpaceNodeWidth, worldSpaceNodeHeight);
+    calculateLayout(browser.getProject(), targets, cmakeConfig, worldSpaceNodeWidth, worldSpaceNodeHeight);
 
     refreshModelMatrices();
     refreshConnections();
@@ -555,23 +555,25 @@ void TargetGraph::Connections::deallocate() {
     GL_DELETE_OBJECT(gl.vao, VertexArrays);
 }
 
-void TargetGraph::Connections::updateTopology(const std::vector<CmagTarget *> &targets, std::string_view cmakeConfig) {
+void TargetGraph::Connections::updateTopology(const CmagProject &project, const std::vector<CmagTarget *> &targets, std::string_view cmakeConfig) {
     connectionsData.clear();
 
-    for (const CmagTarget *srcTarget : targets) {
-        const CmagTargetConfig *config = srcTarget->tryGetConfig(cmakeConfig);
-        if (config == nullptr) {
-            continue;
-        }
+    const CmagDependencyGraph *dependencyGraph = project.findDependencyGraph(cmakeConfig);
+    if (dependencyGraph == nullptr) {
+        return;
+    }
 
-        for (const CmagTarget *dstTarget : config->derived.buildDependencies) {
-            connectionsData.push_back(ConnectionData{srcTarget, dstTarget, CmagDependencyType::Build});
-        }
-        for (const CmagTarget *dstTarget : config->derived.interfaceDependencies) {
-            connectionsData.push_back(ConnectionData{srcTarget, dstTarget, CmagDependencyType::Interface});
-        }
-        for (const CmagTarget *dstTarget : config->derived.manualDependencies) {
-            connectionsData.push_back(ConnectionData{srcTarget, dstTarget, CmagDependencyType::Additional});
+    // A single edge of the graph can represent multiple dependency types. Each of them is a separate connection,
+    // because they are displayed differently.
+    const CmagTarget *projectTargets = project.getTargets().data();
+    for (const CmagTarget *srcTarget : targets) {
+        for (const CmagDependencyGraph::Edge &edge : dependencyGraph->getDependencies(static_cast<size_t>(srcTarget - projectTargets))) {
+            const CmagTarget *dstTarget = projectTargets + edge.targetIndex;
+            for (CmagDependencyType type : {CmagDependencyType::Build, CmagDependencyType::Interface, CmagDependencyType::Additional}) {
+                if (hasCmagDependencyTypeBit(edge.types, type)) {
+                    connectionsData.push_back(ConnectionData{srcTarget, dstTarget, type});
+                }
+            }
         }
     }
 }
@@ -168,7 +168,7 @@ private:
 
         void allocate(const std::vector<CmagTarget *> &targets);
         void deallocate();
-        void updateTopology(const std::vector<CmagTarget *> &targets, std::string_view cmakeConfig);
+        void updateTopology(const CmagProject &project, const std::vector<CmagTarget *> &targets, std::string_view cmakeConfig);
         void update(CmagDependencyType dependencyType, const Shapes &shapes, float arrowLengthScale, float arrowWidthScale, float stippleScale, const CmagTarget *focusedTarget, const CmagTarget *selectedTarget);
         static float calculateSegmentTrimParameter(const CmagTarget &target, const Segment &connectionSegment, const Shapes &shapes, bool isSrcTarget);
         static void calculateArrowCoordinates(const Segment &connectionSegment, float arrowLength, float arrowWidth, Vec &outA, Vec &outB, Vec &outC);
@@ -34,7 +34,7 @@ TooltipBuilder &TooltipBuilder::addHyperlink(const char *newHyperlink) {
     return *this;
 }
 
-TooltipBuilder &TooltipBuilder::addText(const char *text) {
+TooltipBuilder &TooltipBuilder::addText(std::string_view text) {
     FATAL_ERROR_IF(texts.textsCount >= texts.maxTexts, "Too many texts pushed to TooltipBuilder");
 
     texts.texts[texts.textsCount].text = text;
@@ -44,7 +44,7 @@ TooltipBuilder &TooltipBuilder::addText(const char *text) {
     return *this;
 }
 
-TooltipBuilder &TooltipBuilder::addTextOneLine(const char *text) {
+TooltipBuilder &TooltipBuilder::addTextOneLine(std::string_view text) {
     FATAL_ERROR_IF(texts.textsCount >= texts.maxTexts, "Too many texts pushed to TooltipBuilder");
 
     texts.texts[texts.textsCount].text = text;
@@ -80,7 +80,7 @@ bool TooltipBuilder::Hover::isTooltipVisible() const {
 
 void TooltipBuilder::Texts::render(const CmagBrowserTheme &theme) const {
     for (int i = 0; i < textsCount; i++) {
-        if (texts[i].text[0] == '\0') {
+        if (texts[i].text.empty()) {
             continue;
         }
 
@@ -89,7 +89,7 @@ void TooltipBuilder::Texts::render(const CmagBrowserTheme &theme) const {
             oneLineStyle.textWrapWidth(theme.maxWidthPopup);
         }
 
-        ImGui::Text("%s", texts[i].text);
+        ImGui::TextUnformatted(texts[i].text.data(), texts[i].text.data() + texts[i].text.size());
     }
 }
 void TooltipBuilder::Hyperlink::render(const CmagBrowserTheme &theme) const {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <imgui/imgui.h>
+#include <string_view>
 
 class CmagBrowserTheme;
 
@@ -13,8 +14,8 @@ public:
     TooltipBuilder &setHoverAlways();
     TooltipBuilder &hideWhenPopupsAreVisible();
 
-    TooltipBuilder &addText(const char *text);
-    TooltipBuilder &addTextOneLine(const char *text);
+    TooltipBuilder &addText(std::string_view text);
+    TooltipBuilder &addTextOneLine(std::string_view text);
 
     TooltipBuilder &addHyperlink(const char *newHyperlink);
 
@@ -41,7 +42,7 @@ private:
 
     struct Texts {
         struct Text {
-            const char *text = nullptr;
+            std::string_view text = {};
             bool forceOneLine = false;
         };
 
@@ -2,14 +2,12 @@
 
 #include "cmag_core/utils/error.h"
 
-#include <memory>
+#include <algorithm>
 
+// Strongly connected components of the dependency graph are collapsed into single nodes, so the graph is acyclic and
+// every target can be assigned a layer. Targets of a component are placed next to each other in the same layer.
 struct Node {
-    Node() = default;
-    Node(const Node &) = delete;
-    Node(Node &&) = delete;
-
-    CmagTarget *target = nullptr;
+    std::vector<CmagTarget *> targets = {};
     bool isOrphan = false;
 
     // Each step may need to associate some amount of metadata with each node.
@@ -17,121 +15,96 @@ struct Node {
     // in currently executed step.
     union {
         struct {
-            bool removed = false;
+            size_t referencesCount = 0;
         } assignLayers;
     } data = {};
 };
 
-struct Edge {
-    Node *a = nullptr;
-    Node *b = nullptr;
-};
-
 struct Layer {
     std::vector<Node *> nodes = {};
 };
 
 struct Graph {
-    std::unique_ptr<Node[]> nodes = {};
-    size_t nodesCount = 0u;
-    std::vector<Edge> edges = {};
+    const CmagDependencyComponents *components = nullptr;
+    std::vector<Node> nodes = {}; // indexed with component index
     std::vector<Layer> layers = {};
     Layer orphansLayer = {};
 };
 
-static Graph createGraph(const std::vector<CmagTarget *> &targets, std::string_view configName) {
+static Graph createGraph(const CmagProject &project, const std::vector<CmagTarget *> &targets, std::string_view configName) {
     Graph graph = {};
 
-    // Initialize nodes
-    graph.nodesCount = targets.size();
-    graph.nodes = std::make_unique<Node[]>(graph.nodesCount);
-    for (size_t nodeIndex = 0u; nodeIndex < graph.nodesCount; nodeIndex++) {
-        graph.nodes[nodeIndex].target = targets[nodeIndex];
-
-        const bool hasIngoingEdges = targets[nodeIndex]->derived.isReferenced;
-        const bool hasOutgoingEdges = targets[nodeIndex]->tryGetConfig(configName)->derived.allDependencies.size() > 0;
-        if (!hasIngoingEdges && !hasOutgoingEdges) {
-            graph.nodes[nodeIndex].isOrphan = true;
-        }
-    }
-
-    auto findNode = [&graph](const CmagTarget *target) {
-        for (size_t nodeIndex = 0u; nodeIndex < graph.nodesCount; nodeIndex++) {
-            Node &node = graph.nodes[nodeIndex];
-            if (node.target == target) {
-                return &node;
-            }
-        }
-        UNREACHABLE_CODE;
-    };
-
-    // Initialize edges
-    for (const CmagTarget *srcTarget : targets) {
-        for (const CmagTarget *dstTarget : srcTarget->tryGetConfig(configName)->derived.allDependencies) {
-            Node *srcNode = findNode(srcTarget);
-            Node *dstNode = findNode(dstTarget);
-            graph.edges.push_back({srcNode, dstNode});
-        }
+    const CmagDependencyType allTypes = CmagDependencyType::Build | CmagDependencyType::Interface | CmagDependencyType::Additional;
+    const CmagDependencyGraph *dependencyGraph = project.findDependencyGraph(configName);
+    graph.components = project.getDependencyComponents(configName, allTypes);
+    FATAL_ERROR_IF(dependencyGraph == nullptr || graph.components == nullptr, "Dependency graph not derived for config ", configName);
+
+    // Initialize nodes. Components of targets which are not displayed stay empty and are skipped later.
+    graph.nodes.resize(graph.components->getComponentsCount());
+    for (CmagTarget *target : targets) {
+        const auto targetIndex = static_cast<size_t>(target - project.getTargets().data());
+        Node &node = graph.nodes[graph.components->getComponent(targetIndex)];
+        node.targets.push_back(target);
+
+        const bool hasIngoingEdges = !dependencyGraph->getDependents(targetIndex).empty();
+        const bool hasOutgoingEdges = !dependencyGraph->getDependencies(targetIndex).empty();
+        node.isOrphan = !hasIngoingEdges && !hasOutgoingEdges;
     }
 
     return graph;
 }
 
 static void assignLayersTopological(Graph &graph) {
-    // Initialize all nodes to be 'not removed'. We will be removing them later in the process.
-    // Mark all orphans in the graph as 'removed'. We will not assign them to any layers
-    // and they will be assigned positions separately.
-    for (size_t nodeIndex = 0u; nodeIndex < graph.nodesCount; nodeIndex++) {
-        Node &node = graph.nodes[nodeIndex];
-        node.data.assignLayers.removed = node.isOrphan;
-        if (node.isOrphan) {
+    // Orphans are not assigned to any layers. They will be assigned positions separately.
+    // For the rest count how many times each node is referenced by other nodes.
+    auto isLayered = [](const Node &node) {
+        return !node.targets.empty() && !node.isOrphan;
+    };
+    for (Node &node : graph.nodes) {
+        if (!node.targets.empty() && node.isOrphan) {
             graph.orphansLayer.nodes.push_back(&node);
         }
     }
+    for (uint32_t component = 0; component < graph.nodes.size(); component++) {
+        if (!isLayered(graph.nodes[component])) {
+            continue;
+        }
+        for (uint32_t dependencyComponent : graph.components->getComponentDependencies(component)) {
+            graph.nodes[dependencyComponent].data.assignLayers.referencesCount++;
+        }
+    }
 
-    // A helper function to gather all nodes that are not pointed to by any edge. They will be
-    // our next layer.
-    auto getUnreferencedNodes = [&]() {
-        std::vector<Node *> result = {};
-        for (size_t nodeIndex = 0u; nodeIndex < graph.nodesCount; nodeIndex++) {
-            Node &node = graph.nodes[nodeIndex];
-            if (node.data.assignLayers.removed) {
-                continue;
-            }
-
-            bool isNodeReferenced = false;
-            for (Edge &edge : graph.edges) {
-                if (!edge.a->data.assignLayers.removed &&
-                    !edge.b->data.assignLayers.removed &&
-                    edge.b == &node) {
-                    isNodeReferenced = true;
-                    break;
+    // Nodes, which are not referenced by any other node form the first layer. Removing them along with their edges
+    // yields the next layer and so on. Each edge is visited once, so this is linear.
+    Layer currentLayer = {};
+    for (Node &node : graph.nodes) {
+        if (isLayered(node) && node.data.assignLayers.referencesCount == 0) {
+            currentLayer.nodes.push_back(&node);
+        }
+    }
+    while (!currentLayer.nodes.empty()) {
+        Layer nextLayer = {};
+        for (Node *node : currentLayer.nodes) {
+            const auto component = static_cast<uint32_t>(node - graph.nodes.data());
+            for (uint32_t dependencyComponent : graph.components->getComponentDependencies(component)) {
+                Node &dependencyNode = graph.nodes[dependencyComponent];
+                if (isLayered(dependencyNode) && --dependencyNode.data.assignLayers.referencesCount == 0) {
+                    nextLayer.nodes.push_back(&dependencyNode);
                 }
             }
-
-            if (!isNodeReferenced) {
-                result.push_back(&node);
-            }
         }
+        graph.layers.push_back(std::move(currentLayer));
+        currentLayer = std::move(nextLayer);
+    }
 
-        return result;
+    // Keep the order of targets in the project within each layer, so layout is stable.
+    auto compareNodes = [](const Node *a, const Node *b) {
+        return a->targets.front() < b->targets.front();
     };
-
-    auto unreferencedNodes = getUnreferencedNodes();
-    while (!unreferencedNodes.empty()) {
-        // Add all unreferenced nodes as a new layer.
-        graph.layers.push_back(Layer{unreferencedNodes});
-
-        // Remove all unreferenced node from the graph, so that we won't look at them later.
-        // They are already processed in layer assignment step.
-        for (Node *node : unreferencedNodes) {
-            node->data.assignLayers.removed = true;
-        }
-
-        // Query unreferenced nodes again. The result will be different than the last time,
-        // because we removed some nodes and edges.
-        unreferencedNodes = getUnreferencedNodes();
+    for (Layer &layer : graph.layers) {
+        std::sort(layer.nodes.begin(), layer.nodes.end(), compareNodes);
     }
+    std::sort(graph.orphansLayer.nodes.begin(), graph.orphansLayer.nodes.end(), compareNodes);
 }
 
 static void assignCoordinates(Graph &graph, size_t nodeWidth, size_t nodeHeight) {
@@ -141,31 +114,35 @@ static void assignCoordinates(Graph &graph, size_t nodeWidth, size_t nodeHeight)
         const float paddingPercentageVertical = 2.5f;
         const float y = layerIndex * nodeHeight * paddingPercentageVertical;
 
-        for (size_t nodeIndex = 0u; nodeIndex < layer.nodes.size(); nodeIndex++) {
-            Node &node = *layer.nodes[nodeIndex];
-            const float paddingPercentageHorizontal = 1.4f;
-            const float x = nodeIndex * paddingPercentageHorizontal * nodeWidth;
+        size_t slotIndex = 0u;
+        for (Node *node : layer.nodes) {
+            for (CmagTarget *target : node->targets) {
+                const float paddingPercentageHorizontal = 1.4f;
+                const float x = slotIndex * paddingPercentageHorizontal * nodeWidth;
+                slotIndex++;
 
-            CmagTargetGraphicalData &graphical = node.target->graphical;
-            graphical.x = x;
-            graphical.y = y;
+                CmagTargetGraphicalData &graphical = target->graphical;
+                graphical.x = x;
+                graphical.y = y;
+            }
         }
     }
 
     for (size_t nodeIndex = 0u; nodeIndex < graph.orphansLayer.nodes.size(); nodeIndex++) {
         Node &node = *graph.orphansLayer.nodes[nodeIndex];
-        CmagTargetGraphicalData &graphical = node.target->graphical;
+        CmagTargetGraphicalData &graphical = node.targets.front()->graphical;
 
         graphical.x = -100;
         graphical.y = nodeIndex * nodeHeight * 1.05f;
     }
 }
 
-void calculateLayout(const std::vector<CmagTarget *> &targets,
+void calculateLayout(const CmagProject &project,
+                     const std::vector<CmagTarget *> &targets,
                      std::string_view configName,
                      size_t nodeWidth,
                      size_t nodeHeight) {
-    Graph graph = createGraph(targets, configName);
+    Graph graph = createGraph(project, targets, configName);
     assignLayersTopological(graph);
     assignCoordinates(graph, nodeWidth, nodeHeight);
 }
@@ -4,7 +4,8 @@
 
 #include <vector>
 
-void calculateLayout(const std::vector<CmagTarget *> &targets,
+void calculateLayout(const CmagProject &project,
+                     const std::vector<CmagTarget *> &targets,
                      std::string_view configName,
                      size_t nodeWidth,
                      size_t nodeHeight);
@@ -0,0 +1,221 @@
+#include "project_journal.h"
+
+#include "cmag_core/utils/error.h"
+#include "cmag_core/utils/file_utils.h"
+
+#include <fstream>
+#include <type_traits>
+
+ProjectJournal::ProjectJournal(const fs::path &projectFilePath)
+    : projectFilePath(projectFilePath),
+      journalPath(getJournalPath(projectFilePath)) {
+    std::error_code error{};
+    const auto existingSize = fs::file_size(journalPath, error);
+    if (!error) {
+        fileSize = static_cast<size_t>(existingSize);
+    }
+}
+
+fs::path ProjectJournal::getJournalPath(const fs::path &projectFilePath) {
+    fs::path result = projectFilePath;
+    result += ".journal";
+    return result;
+}
+
+bool ProjectJournal::replay(const fs::path &projectFilePath, CmagProject &project) {
+    const fs::path journalPath = getJournalPath(projectFilePath);
+    const std::optional<std::string> content = readFile(journalPath);
+    if (!content.has_value()) {
+        return false;
+    }
+
+    // Verify the journal was created for current version of the project file
+    const std::string_view contentView = content.value();
+    const size_t headerEnd = contentView.find('\n');
+    if (headerEnd == std::string_view::npos || contentView.substr(0, headerEnd + 1) != createHeader(projectFilePath)) {
+        LOG_WARNING("Discarding outdated project journal ", journalPath.string());
+        std::error_code error{};
+        fs::remove(journalPath, error);
+        return false;
+    }
+
+    // Apply entries in order. The last entry could be incomplete, if the browser was killed while writing it.
+    for (size_t lineStart = headerEnd + 1; lineStart < contentView.size();) {
+        const size_t lineEnd = contentView.find('\n', lineStart);
+        if (lineEnd == std::string_view::npos) {
+            break;
+        }
+        const nlohmann::json entry = nlohmann::json::parse(contentView.substr(lineStart, lineEnd - lineStart), nullptr, false);
+        if (entry.is_discarded() || !replayEntry(entry, project)) {
+            LOG_WARNING("Ignoring invalid entry in project journal ", journalPath.string());
+        }
+        lineStart = lineEnd + 1;
+    }
+    return true;
+}
+
+void ProjectJournal::recordTargetPosition(const CmagTarget &target) {
+    recordEntry({
+        {"type", "targetPosition"},
+        {"target", target.name},
+        {"x", target.graphical.x},
+        {"y", target.graphical.y},
+    });
+}
+
+void ProjectJournal::recordCamera(const CmagGlobals::BrowserData &browser) {
+    recordEntry({
+        {"type", "camera"},
+        {"x", browser.cameraX},
+        {"y", browser.cameraY},
+        {"scale", browser.cameraScale},
+    });
+}
+
+void ProjectJournal::recordSelectedConfig(const CmagGlobals &globals) {
+    recordEntry({
+        {"type", "selectedConfig"},
+        {"value", globals.selectedConfig},
+    });
+}
+
+void ProjectJournal::recordSelectedTab(const CmagGlobals::BrowserData &browser) {
+    recordEntry({
+        {"type", "selectedTab"},
+        {"value", browser.selectedTabIndex},
+    });
+}
+
+void ProjectJournal::recordDisplayedDependencyType(const CmagGlobals::BrowserData &browser) {
+    recordEntry({
+        {"type", "displayedDependencyType"},
+        {"value", browser.displayedDependencyType},
+    });
+}
+
+void ProjectJournal::recordSelectedTarget(const CmagGlobals::BrowserData &browser) {
+    recordEntry({
+        {"type", "selectedTarget"},
+        {"value", browser.selectedTargetName},
+    });
+}
+
+bool ProjectJournal::flush() {
+    if (pendingEntries.empty()) {
+        return true;
+    }
+
+    if (fileSize == 0) {
+        pendingEntries.insert(0, createHeader(projectFilePath));
+    }
+
+    std::ofstream file{journalPath, std::ios::out | std::ios::app | std::ios::binary};
+    if (!file) {
+        return false;
+    }
+    file.write(pendingEntries.data(), static_cast<std::streamsize>(pendingEntries.size()));
+    file.close();
+    if (!file) {
+        return false;
+    }
+
+    fileSize += pendingEntries.size();
+    pendingEntries.clear();
+    return true;
+}
+
+void ProjectJournal::reset() {
+    pendingEntries.clear();
+    fileSize = 0;
+
+    std::error_code error{};
+    fs::remove(journalPath, error);
+}
+
+std::string ProjectJournal::createHeader(const fs::path &projectFilePath) {
+    std::error_code sizeError{};
+    std::error_code timeError{};
+    const auto projectFileSize = fs::file_size(projectFilePath, sizeError);
+    const auto projectFileTime = fs::last_write_time(projectFilePath, timeError);
+    if (sizeError || timeError) {
+        return {};
+    }
+
+    const nlohmann::json header = {
+        {"journalVersion", 1},
+        {"projectFileSize", projectFileSize},
+        {"projectFileTime", static_cast<int64_t>(projectFileTime.time_since_epoch().count())},
+    };
+    return header.dump() + '\n';
+}
+
+void ProjectJournal::recordEntry(const nlohmann::json &entry) {
+    pendingEntries += entry.dump();
+    pendingEntries += '\n';
+}
+
+bool ProjectJournal::replayEntry(const nlohmann::json &entry, CmagProject &project) {
+    if (!entry.is_object()) {
+        return false;
+    }
+    auto readField = [&entry](const char *name, auto &dst) {
+        using DstT = std::remove_reference_t<decltype(dst)>;
+        const auto it = entry.find(name);
+        if (it == entry.end()) {
+            return false;
+        }
+        if constexpr (std::is_same_v<DstT, std::string>) {
+            if (!it->is_string()) {
+                return false;
+            }
+        } else {
+            if (!it->is_number()) {
+                return false;
+            }
+        }
+        dst = it->template get<DstT>();
+        return true;
+    };
+
+    std::string type = {};
+    if (!readField("type", type)) {
+        return false;
+    }
+
+    CmagGlobals &globals = project.getGlobals();
+    if (type == "targetPosition") {
+        std::string targetName = {};
+        CmagTargetGraphicalData graphical = {};
+        if (!readField("target", targetName) || !readField("x", graphical.x) || !readField("y", graphical.y)) {
+            return false;
+        }
+        CmagTarget *target = project.findTargetByName(targetName);
+        if (target == nullptr) {
+            return false;
+        }
+        target->graphical.x = graphical.x;
+        target->graphical.y = graphical.y;
+        return true;
+    }
+    if (type == "camera") {
+        CmagGlobals::BrowserData browser = globals.browser;
+        if (!readField("x", browser.cameraX) || !readField("y", browser.cameraY) || !readField("scale", browser.cameraScale)) {
+            return false;
+        }
+        globals.browser = std::move(browser);
+        return true;
+    }
+    if (type == "selectedConfig") {
+        return readField("value", globals.selectedConfig);
+    }
+    if (type == "selectedTab") {
+        return readField("value", globals.browser.selectedTabIndex);
+    }
+    if (type == "displayedDependencyType") {
+        return readField("value", globals.browser.displayedDependencyType);
+    }
+    if (type == "selectedTarget") {
+        return readField("value", globals.browser.selectedTargetName);
+    }
+    return false;
+}
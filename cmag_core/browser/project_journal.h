@@ -0,0 +1,41 @@
+#pragma once
+
+#include "cmag_core/core/cmag_project.h"
+#include "cmag_core/utils/filesystem.h"
+
+#include <nlohmann/json.hpp>
+#include <string>
+
+// Append-only sidecar file storing changes of browser-only state, like node positions or camera, made after the
+// project file was last written. Rewriting a huge project file after every small change is slow, so the changes are
+// recorded here and compacted into the project file only occasionally. Each line of the journal is a small json
+// object. The first one is a header identifying the project file it applies to. If the project file is modified
+// by anything else, the journal becomes stale and is discarded.
+class ProjectJournal {
+public:
+    explicit ProjectJournal(const fs::path &projectFilePath);
+
+    static fs::path getJournalPath(const fs::path &projectFilePath);
+    static bool replay(const fs::path &projectFilePath, CmagProject &project);
+
+    void recordTargetPosition(const CmagTarget &target);
+    void recordCamera(const CmagGlobals::BrowserData &browser);
+    void recordSelectedConfig(const CmagGlobals &globals);
+    void recordSelectedTab(const CmagGlobals::BrowserData &browser);
+    void recordDisplayedDependencyType(const CmagGlobals::BrowserData &browser);
+    void recordSelectedTarget(const CmagGlobals::BrowserData &browser);
+    bool flush();
+    void reset(); // should be called after the project file is written
+
+    size_t getFileSize() const { return fileSize; }
+
+private:
+    static std::string createHeader(const fs::path &projectFilePath);
+    void recordEntry(const nlohmann::json &entry);
+    static bool replayEntry(const nlohmann::json &entry, CmagProject &project);
+
+    const fs::path projectFilePath;
+    const fs::path journalPath;
+    std::string pendingEntries = {};
+    size_t fileSize = 0;
+};
@@ -2,6 +2,7 @@
 
 #include "cmag_core/core/cmake_generator.h"
 #include "cmag_core/utils/string_utils.h"
+#include "cmag_core/utils/thread_pool.h"
 
 #include <algorithm>
 #include <cstring>
@@ -32,7 +33,24 @@ const char *cmagTargetTypeToString(CmagTargetType type) {
     }
 }
 
+CmagProject::CmagProject(std::pmr::memory_resource *upstreamMemoryResource)
+    : memoryResource(std::make_unique<std::pmr::monotonic_buffer_resource>(upstreamMemoryResource)),
+      propertyValues(memoryResource.get()) {}
+
+std::pmr::memory_resource *CmagProject::createMemoryResource() {
+    std::pmr::memory_resource *upstreamMemoryResource = memoryResource->upstream_resource();
+    return additionalMemoryResources.emplace_back(std::make_unique<std::pmr::monotonic_buffer_resource>(upstreamMemoryResource)).get();
+}
+
+std::string_view CmagProject::storeRawData(std::string_view data) {
+    return storeString(data, memoryResource.get());
+}
+
 bool CmagProject::addTarget(CmagTarget &&newTarget) {
+    // New targets can reallocate the vector and change resolution of dependencies, so we'll need a full derivation.
+    needsFullDerive = true;
+    internPropertyStrings(newTarget);
+
     // Register target's config if we haven't seen it yet.
     for (const CmagTargetConfig &config : newTarget.configs) {
         addConfig(config.name);
@@ -40,13 +58,24 @@ bool CmagProject::addTarget(CmagTarget &&newTarget) {
 
     // Look, whether we already have a target of that name. In that case, we will
     // merge them, because it is a definition of the target for a different config.
-    for (CmagTarget &existingTarget : targets) {
+    auto nameIt = targetIndicesByName.find(newTarget.name);
+    if (nameIt != targetIndicesByName.end()) {
+        CmagTarget &existingTarget = targets[nameIt->second];
         if (existingTarget.name == newTarget.name) {
             return mergeTargets(existingTarget, std::move(newTarget));
         }
     }
 
-    // If we hadn't found a matching existing target, we create new one.
+    // If we hadn't found a matching existing target, we create new one. Actual target names take precedence over aliases.
+    const size_t targetIndex = targets.size();
+    if (nameIt != targetIndicesByName.end()) {
+        nameIt->second = targetIndex;
+    } else {
+        targetIndicesByName.emplace(storeRawData(newTarget.name), targetIndex);
+    }
+    for (const std::string &alias : newTarget.aliases) {
+        addTargetName(alias, targetIndex);
+    }
     targets.push_back(std::move(newTarget));
     return true;
 }
@@ -73,16 +102,51 @@ bool CmagProject::mergeTargets(CmagTarget &dst, CmagTarget &&src) {
 }
 
 bool CmagProject::addTargetAlias(std::string_view aliasName, std::string_view aliasedTargetName) {
-    for (CmagTarget &target : targets) {
-        if (target.name != aliasedTargetName) {
-            continue;
-        }
+    CmagTarget *target = findTargetByName(aliasedTargetName);
+    if (target == nullptr || target->name != aliasedTargetName) {
+        return false;
+    }
 
-        target.aliases.emplace_back(aliasName);
-        return true;
+    target->aliases.emplace_back(aliasName);
+    needsFullDerive = true;
+    addTargetName(aliasName, static_cast<size_t>(target - targets.data()));
+    return true;
+}
+
+void CmagProject::addTargetName(std::string_view name, size_t targetIndex) {
+    // Do not overwrite existing entries. If an alias collides with a name of some other target, we prefer the
+    // target which was registered first.
+    if (targetIndicesByName.find(name) == targetIndicesByName.end()) {
+        targetIndicesByName.emplace(storeRawData(name), targetIndex);
+    }
+}
+
+CmagTarget *CmagProject::findTargetByName(std::string_view nameOrAlias) {
+    auto it = targetIndicesByName.find(nameOrAlias);
+    if (it == targetIndicesByName.end()) {
+        return nullptr;
+    }
+    return &targets[it->second];
+}
+
+const CmagTarget *CmagProject::findTargetByName(std::string_view nameOrAlias) const {
+    auto it = targetIndicesByName.find(nameOrAlias);
+    if (it == targetIndicesByName.end()) {
+        return nullptr;
     }
+    return &targets[it->second];
+}
 
-    return false;
+CmagBrowserStateSnapshot CmagProject::createBrowserStateSnapshot() const {
+    CmagBrowserStateSnapshot snapshot = {};
+    snapshot.darkMode = globals.darkMode;
+    snapshot.selectedConfig = globals.selectedConfig;
+    snapshot.browser = globals.browser;
+    snapshot.targetsGraphical.reserve(targets.size());
+    for (const CmagTarget &target : targets) {
+        snapshot.targetsGraphical.push_back(target.graphical);
+    }
+    return snapshot;
 }
 
 void CmagProject::addConfig(std::string_view config) {
@@ -90,40 +154,324 @@ void CmagProject::addConfig(std::string_view config) {
         configs.emplace_back(config);
     }
 }
-bool CmagProject::deriveData() {
+bool CmagProject::deriveData(bool multithreaded) {
+    needsFullDerive = false;
+    dirtyTargetIndices.clear();
+
+    deriveTargets(multithreaded);
+    deriveDependencyReferences();
+    deriveDependencyGraphs();
+    return globals.deriveData(targets);
+}
+
+void CmagProject::deriveTargets(bool multithreaded) {
+    // Strings and property indices have to be derived up front on one thread, because they may add new entries to the
+    // property tables. Strings were interned when targets were added, so it's only a check for modified properties.
     for (CmagTarget &target : targets) {
         target.derived = {};
+        internPropertyStrings(target);
+        for (CmagTargetConfig &config : target.configs) {
+            config.deriveDataPropertyIndices(propertyNames);
+        }
     }
 
-    for (CmagTarget &target : targets) {
-        target.deriveData(targets);
+    // Rest of the derivation only modifies the target being derived, so targets can be processed concurrently. Spawning
+    // threads pays off only if each of them gets enough targets, so small projects are always derived on one thread.
+    constexpr size_t minTargetsPerThread = 128;
+    const size_t maxThreadsCount = multithreaded ? ThreadPool::getDefaultThreadsCount() : 1;
+    const size_t threadsCount = std::clamp<size_t>(targets.size() / minTargetsPerThread, 1, maxThreadsCount);
+    if (threadsCount > 1) {
+        ThreadPool threadPool{threadsCount};
+        threadPool.parallelFor(targets.size(), [this](size_t targetIndex) {
+            targets[targetIndex].deriveData(*this);
+        });
+    } else {
+        for (CmagTarget &target : targets) {
+            target.deriveData(*this);
+        }
     }
-    deriveUnmatchedDependencies();
-    return globals.deriveData(targets);
 }
 
-void CmagProject::deriveUnmatchedDependencies() {
-    auto &result = derived.unmatchedDependencies;
+void CmagProject::internPropertyStrings(CmagTarget &target) {
+    for (CmagTargetConfig &config : target.configs) {
+        config.internPropertyStrings(propertyNames, propertyValues);
+    }
+}
 
+void CmagProject::deriveDependencyReferences() {
+    derived = {};
     for (const CmagTarget &target : targets) {
-        for (const CmagTargetConfig &config : target.configs) {
-            for (const std::string &dependency : config.derived.unmatchedDependencies) {
-                // Skip dependencies that cannot be CMake targets, e.g. absolute paths to system libraries.
-                if (!isValidCmakeTargetName(dependency, true)) {
-                    continue;
-                }
+        addDependencyReferences(target);
+    }
+}
 
-                // Insert while ensuring uniqueness. We could use a set or keep a sorted order and
-                // search with bisection, but this brute-force linear search should be good for now.
-                if (std::find_if(result.begin(), result.end(), [&](const std::string &x) { return x == dependency; }) == result.end()) {
-                    result.push_back(dependency);
-                }
+void CmagProject::addDependencyReferences(const CmagTarget &target) {
+    const size_t targetIndex = static_cast<size_t>(&target - targets.data());
+    for (const CmagTargetConfig &config : target.configs) {
+        for (const CmagTarget *dependency : config.derived.allDependencies) {
+            CmagTarget &dependencyTarget = targets[dependency - targets.data()];
+            dependencyTarget.derived.referencesCount++;
+            dependencyTarget.derived.isReferenced = true;
+        }
+
+        for (const std::string &dependency : config.derived.unmatchedDependencies) {
+            // Skip dependencies that cannot be CMake targets, e.g. absolute paths to system libraries.
+            if (!isValidCmakeTargetName(dependency, true)) {
+                continue;
+            }
+
+            // Insert while ensuring uniqueness. The map is keyed by name, the vector keeps the order of first reference.
+            // Entries which lost all their references during incremental derivation are still in the vector, so
+            // they're not inserted again.
+            auto [referencesIt, isNew] = derived.unmatchedDependencyReferences.try_emplace(dependency);
+            UnmatchedDependencyReferences &references = referencesIt->second;
+            if (isNew) {
+                derived.unmatchedDependencies.push_back(dependency);
+            }
+            references.count++;
+            auto targetIt = std::lower_bound(references.targetIndices.begin(), references.targetIndices.end(), targetIndex);
+            if (targetIt == references.targetIndices.end() || *targetIt != targetIndex) {
+                references.targetIndices.insert(targetIt, targetIndex);
+            }
+        }
+    }
+}
+
+void CmagProject::removeDependencyReferences(const CmagTarget &target) {
+    const size_t targetIndex = static_cast<size_t>(&target - targets.data());
+    for (const CmagTargetConfig &config : target.configs) {
+        for (const CmagTarget *dependency : config.derived.allDependencies) {
+            CmagTarget &dependencyTarget = targets[dependency - targets.data()];
+            dependencyTarget.derived.referencesCount--;
+            dependencyTarget.derived.isReferenced = dependencyTarget.derived.referencesCount > 0;
+        }
+
+        for (const std::string &dependency : config.derived.unmatchedDependencies) {
+            auto referencesIt = derived.unmatchedDependencyReferences.find(dependency);
+            if (referencesIt == derived.unmatchedDependencyReferences.end()) {
+                continue;
+            }
+            UnmatchedDependencyReferences &references = referencesIt->second;
+            if (--references.count == 0) {
+                // Removal from the vector has to preserve the order, so it's done for all entries at once after
+                // the dirty targets are derived again. They may reference the dependency again in the meantime.
+                references.targetIndices.clear();
+                derived.hasUnreferencedUnmatchedDependencies = true;
+                continue;
+            }
+            auto targetIt = std::lower_bound(references.targetIndices.begin(), references.targetIndices.end(), targetIndex);
+            if (targetIt != references.targetIndices.end() && *targetIt == targetIndex) {
+                references.targetIndices.erase(targetIt);
             }
         }
     }
 }
 
-void CmagTargetConfig::fixupWithNonEvaled(std::string_view propertyName, std::string_view nonEvaledValue) {
+void CmagProject::removeUnreferencedUnmatchedDependencies() {
+    if (!derived.hasUnreferencedUnmatchedDependencies) {
+        return;
+    }
+    derived.hasUnreferencedUnmatchedDependencies = false;
+
+    auto &unmatched = derived.unmatchedDependencies;
+    auto newEnd = std::remove_if(unmatched.begin(), unmatched.end(), [this](const std::string &dependency) {
+        auto referencesIt = derived.unmatchedDependencyReferences.find(dependency);
+        if (referencesIt->second.count > 0) {
+            return false;
+        }
+        derived.unmatchedDependencyReferences.erase(referencesIt);
+        return true;
+    });
+    unmatched.erase(newEnd, unmatched.end());
+}
+
+const std::vector<size_t> *CmagProject::findUnmatchedDependencyTargetIndices(std::string_view dependencyName) const {
+    // The map is not transparent, so the key is built once for the lookup. It's only queried for displaying.
+    auto it = derived.unmatchedDependencyReferences.find(std::string{dependencyName});
+    if (it == derived.unmatchedDependencyReferences.end() || it->second.count == 0) {
+        return nullptr;
+    }
+    return &it->second.targetIndices;
+}
+
+void CmagProject::deriveDependencyGraphs() {
+    derived.dependencyAnalyses.clear();
+    derived.dependencyGraphs.resize(configs.size());
+    std::vector<CmagDependencyGraph::Edge> targetDependencies = {};
+    for (size_t configIndex = 0; configIndex < configs.size(); configIndex++) {
+        CmagDependencyGraph &graph = derived.dependencyGraphs[configIndex];
+        graph.clear();
+        for (const CmagTarget &target : targets) {
+            collectDependencyGraphEdges(target, configIndex, targetDependencies);
+            graph.addTarget(targetDependencies);
+        }
+        graph.finalize();
+    }
+}
+
+void CmagProject::updateDependencyGraphs() {
+    // Replaced configs of a target may have introduced a new config, which doesn't have a graph yet.
+    if (derived.dependencyGraphs.size() != configs.size()) {
+        deriveDependencyGraphs();
+        return;
+    }
+
+    // Only edges of the dirty targets could have changed, so they are patched into existing graphs. Cached analyses
+    // are dropped only for configs and dependency types, which actually changed.
+    std::vector<CmagDependencyGraph::Edge> targetDependencies = {};
+    for (size_t configIndex = 0; configIndex < configs.size(); configIndex++) {
+        CmagDependencyGraph &graph = derived.dependencyGraphs[configIndex];
+        CmagDependencyType changedTypes = CmagDependencyType::NONE;
+        for (size_t targetIndex : dirtyTargetIndices) {
+            collectDependencyGraphEdges(targets[targetIndex], configIndex, targetDependencies);
+            changedTypes = changedTypes | graph.replaceTarget(targetIndex, targetDependencies);
+        }
+        if (changedTypes == CmagDependencyType::NONE) {
+            continue;
+        }
+        graph.finalize();
+
+        for (size_t types = 0; types < dependencyTypesCombinationsCount; types++) {
+            const size_t cacheIndex = configIndex * dependencyTypesCombinationsCount + types;
+            if (cacheIndex < derived.dependencyAnalyses.size() && hasCmagDependencyTypeBit(static_cast<CmagDependencyType>(types), changedTypes)) {
+                derived.dependencyAnalyses[cacheIndex] = {};
+            }
+        }
+    }
+}
+
+void CmagProject::collectDependencyGraphEdges(const CmagTarget &target, size_t configIndex, std::vector<CmagDependencyGraph::Edge> &outEdges) const {
+    outEdges.clear();
+    const CmagTargetConfig *config = target.tryGetConfig(configs[configIndex]);
+    if (config == nullptr) {
+        return;
+    }
+
+    auto addEdges = [&](const std::vector<const CmagTarget *> &dependencies, CmagDependencyType type) {
+        for (const CmagTarget *dependency : dependencies) {
+            outEdges.push_back(CmagDependencyGraph::Edge{static_cast<uint32_t>(dependency - targets.data()), type});
+        }
+    };
+    addEdges(config->derived.buildDependencies, CmagDependencyType::Build);
+    addEdges(config->derived.interfaceDependencies, CmagDependencyType::Interface);
+    addEdges(config->derived.manualDependencies, CmagDependencyType::Additional);
+}
+
+const CmagDependencyGraph *CmagProject::findDependencyGraph(std::string_view configName) const {
+    auto it = std::find(configs.begin(), configs.end(), configName);
+    if (it == configs.end() || derived.dependencyGraphs.size() != configs.size()) {
+        return nullptr;
+    }
+    return &derived.dependencyGraphs[static_cast<size_t>(it - configs.begin())];
+}
+
+CmagProject::DependencyAnalysis *CmagProject::getDependencyAnalysis(std::string_view configName, CmagDependencyType types) const {
+    const CmagDependencyGraph *graph = findDependencyGraph(configName);
+    if (graph == nullptr) {
+        return nullptr;
+    }
+
+    const auto configIndex = static_cast<size_t>(graph - derived.dependencyGraphs.data());
+    const size_t cacheIndex = configIndex * dependencyTypesCombinationsCount + static_cast<size_t>(types);
+    if (derived.dependencyAnalyses.size() <= cacheIndex) {
+        derived.dependencyAnalyses.resize(configs.size() * dependencyTypesCombinationsCount);
+    }
+    return &derived.dependencyAnalyses[cacheIndex];
+}
+
+const CmagDependencyComponents *CmagProject::getDependencyComponents(std::string_view configName, CmagDependencyType types) const {
+    DependencyAnalysis *analysis = getDependencyAnalysis(configName, types);
+    if (analysis == nullptr) {
+        return nullptr;
+    }
+    if (analysis->components == nullptr) {
+        analysis->components = std::make_unique<CmagDependencyComponents>(*findDependencyGraph(configName), types);
+    }
+    return analysis->components.get();
+}
+
+const CmagDependencyReachability *CmagProject::getDependencyReachability(std::string_view configName, CmagDependencyType types) const {
+    DependencyAnalysis *analysis = getDependencyAnalysis(configName, types);
+    if (analysis == nullptr) {
+        return nullptr;
+    }
+    if (analysis->reachability == nullptr) {
+        analysis->reachability = std::make_unique<CmagDependencyReachability>(*getDependencyComponents(configName, types));
+    }
+    return analysis->reachability.get();
+}
+
+bool CmagProject::markTargetDirty(std::string_view targetName) {
+    CmagTarget *target = findTargetByName(targetName);
+    if (target == nullptr || target->name != targetName) {
+        return false;
+    }
+    if (needsFullDerive) {
+        return true;
+    }
+
+    const size_t targetIndex = static_cast<size_t>(target - targets.data());
+    if (std::find(dirtyTargetIndices.begin(), dirtyTargetIndices.end(), targetIndex) != dirtyTargetIndices.end()) {
+        return true;
+    }
+
+    // Retract everything the target has contributed to the derived data of other targets. It will be added
+    // back after re-derivation.
+    removeDependencyReferences(*target);
+    dirtyTargetIndices.push_back(targetIndex);
+    return true;
+}
+
+bool CmagProject::replaceTargetConfigs(std::string_view targetName, std::vector<CmagTargetConfig> &&newConfigs) {
+    if (!markTargetDirty(targetName)) {
+        return false;
+    }
+
+    CmagTarget &target = *findTargetByName(targetName);
+    target.configs = std::move(newConfigs);
+    for (const CmagTargetConfig &config : target.configs) {
+        addConfig(config.name);
+    }
+    internPropertyStrings(target);
+    return true;
+}
+
+bool CmagProject::deriveDirtyData() {
+    if (needsFullDerive) {
+        return deriveData();
+    }
+
+    // Names of the targets do not change, so dependencies of other targets are still resolved correctly. We
+    // only have to derive the dirty targets and update the data they contribute to.
+    for (size_t targetIndex : dirtyTargetIndices) {
+        internPropertyStrings(targets[targetIndex]);
+        for (CmagTargetConfig &config : targets[targetIndex].configs) {
+            config.deriveDataPropertyIndices(propertyNames);
+        }
+    }
+
+    bool success = true;
+    for (size_t targetIndex : dirtyTargetIndices) {
+        CmagTarget &target = targets[targetIndex];
+        target.deriveData(*this);
+        addDependencyReferences(target);
+        success = globals.deriveDataForTarget(targets, targetIndex) && success;
+    }
+    removeUnreferencedUnmatchedDependencies();
+
+    if (!dirtyTargetIndices.empty()) {
+        updateDependencyGraphs();
+    }
+    dirtyTargetIndices.clear();
+    return success;
+}
+
+void CmagTargetConfig::fixupWithNonEvaled(std::string_view propertyName, std::string_view nonEvaledValue, std::pmr::memory_resource *memoryResource) {
+    CmagGenexCache genexCache{};
+    fixupWithNonEvaled(propertyName, nonEvaledValue, memoryResource, genexCache);
+}
+
+void CmagTargetConfig::fixupWithNonEvaled(std::string_view propertyName, std::string_view nonEvaledValue, std::pmr::memory_resource *memoryResource, CmagGenexCache &genexCache) {
     if (propertyName == "LINK_LIBRARIES" || propertyName == "INTERFACE_LINK_LIBRARIES") {
         // Find the property
         auto it = std::find_if(properties.begin(), properties.end(), [propertyName](const CmagTargetProperty &p) {
@@ -134,162 +482,148 @@ void CmagTargetConfig::fixupWithNonEvaled(std::string_view propertyName, std::st
         }
 
         // Remove directory id from our property.
-        fixupLinkLibrariesDirectoryId(it->value);
+        std::string valueWithoutDirectoryId = {};
+        std::string_view value = it->value;
+        if (fixupLinkLibrariesDirectoryId(value, valueWithoutDirectoryId)) {
+            value = valueWithoutDirectoryId;
+        }
 
         // Remove directory id from evaled property value, so we can use it for genex fixup.
-        std::string nonEvaledValueFixed = std::string{nonEvaledValue};
-        fixupLinkLibrariesDirectoryId(nonEvaledValueFixed);
+        std::string nonEvaledValueWithoutDirectoryId = {};
+        if (fixupLinkLibrariesDirectoryId(nonEvaledValue, nonEvaledValueWithoutDirectoryId)) {
+            nonEvaledValue = nonEvaledValueWithoutDirectoryId;
+        }
 
         // Finaly fixup genexes
-        fixupLinkLibrariesGenex(*it, nonEvaledValueFixed);
+        std::string valueWithoutGenexes = {};
+        if (fixupLinkLibrariesGenex(value, genexCache.parse(nonEvaledValue), valueWithoutGenexes)) {
+            value = valueWithoutGenexes;
+        }
+
+        // Values are views, so only a changed value has to be stored.
+        if (value.data() != it->value.data()) {
+            it->value = storeString(value, memoryResource);
+        }
     }
 }
 
-void CmagTargetConfig::fixupLinkLibrariesDirectoryId(std::string &value) {
+bool CmagTargetConfig::fixupLinkLibrariesDirectoryId(std::string_view value, std::string &outFixedValue) {
     // When target_link_libraries() is called in a different directory than add_libraries(), CMake
     // will wrap target XXX with following syntax: ::@(000002F0C2555640);XXX;::@. We have to extract
-    // XXX from every instance of this string and remove the wrapping characters.
+    // XXX from every instance of this string and remove the wrapping characters. Link lists can be
+    // long, so we do it in a single pass, copying unwrapped parts to a new string.
+    constexpr std::string_view directoryIdStartPattern = "::@(";
+    constexpr std::string_view directoryIdEndPattern = ");";
+    constexpr std::string_view entryEndPattern = ";::@";
+
+    const std::string_view input = value;
+    size_t directoryIdStartPos = findSubstring(input, directoryIdStartPattern, 0);
+    if (directoryIdStartPos == std::string_view::npos) {
+        return false;
+    }
 
+    std::string &result = outFixedValue;
+    result.clear();
+    result.reserve(input.size());
     size_t currentOffset = 0;
-
-    while (true) {
-        const size_t directoryIdStartPos = value.find("::@(", currentOffset);
-        if (directoryIdStartPos == std::string::npos) {
-            break;
-        }
-
-        constexpr const char *directoryIdEndPattern = ");";
-        constexpr size_t directoryIdEndPatternLength = std::char_traits<char>::length(directoryIdEndPattern);
-        const size_t directoryIdEndPos = value.find(directoryIdEndPattern, directoryIdStartPos);
-        if (directoryIdEndPos == std::string::npos) {
+    while (directoryIdStartPos != std::string_view::npos) {
+        const size_t directoryIdEndPos = findSubstring(input, directoryIdEndPattern, directoryIdStartPos);
+        if (directoryIdEndPos == std::string_view::npos) {
             // Unclosed pattern, give up and ignore
             break;
         }
 
-        constexpr const char *entryEndPattern = ";::@";
-        constexpr size_t entryEndPatternLength = std::char_traits<char>::length(entryEndPattern);
-        const size_t entryEndPos = value.find(entryEndPattern, directoryIdEndPos);
-        if (entryEndPos == std::string::npos) {
+        const size_t entryEndPos = findSubstring(input, entryEndPattern, directoryIdEndPos);
+        if (entryEndPos == std::string_view::npos) {
             // Unclosed pattern, give up and ignore
             break;
         }
 
-        {
-            size_t removeStart = entryEndPos;
-            size_t removeEnd = entryEndPatternLength;
-            value.erase(removeStart, removeEnd);
-        }
-        {
-            size_t removeStart = directoryIdStartPos;
-            size_t removeEnd = directoryIdEndPos - directoryIdStartPos + directoryIdEndPatternLength;
-            value.erase(removeStart, removeEnd);
-        }
+        const size_t entryStartPos = std::min(directoryIdEndPos + directoryIdEndPattern.size(), entryEndPos);
+        result.append(input.substr(currentOffset, directoryIdStartPos - currentOffset));
+        result.append(input.substr(entryStartPos, entryEndPos - entryStartPos));
+
+        currentOffset = entryEndPos + entryEndPattern.size();
+        directoryIdStartPos = findSubstring(input, directoryIdStartPattern, currentOffset);
     }
+    result.append(input.substr(currentOffset));
+    return true;
 }
 
-void CmagTargetConfig::fixupLinkLibrariesGenex(CmagTargetProperty &property, std::string_view nonEvaledValue) {
+bool CmagTargetConfig::fixupLinkLibrariesGenex(std::string_view evaledValue, const CmagGenexTree &nonEvaledValue, std::string &outFixedValue) {
     // LINK_LIBRARIES and INTERFACE_LINK_LIBRARIES may contain a generator expression $<LINK_ONLY:XXX>.
     // This resolves to XXX, when evaluating with $<GENEX_EVAL>, even though we would expect it
     // to be empty. As a workaround we dump both evaled and non-evaled versions. Non evaled version can
     // to look up which entries are in form $<LINK_ONLY:XXX>. Then we can remove these entries from
     // evaled version.
 
-    std::string &evaledValue = property.value;
-
-    // Early return if we have no genexes
-    if (nonEvaledValue.find('$') == std::string::npos) {
-        return;
+    // Malformed genex, don't try to save it
+    if (!nonEvaledValue.isValid()) {
+        return false;
     }
 
-    // Find all values wrapped with $<LINK_ONLY>
-    const char *prefix = "$<LINK_ONLY:";
-    const size_t prefixLength = strlen(prefix);
-    size_t genexDepth = 0;
+    // Find all list entries containing a non-empty $<LINK_ONLY>
+    const CmagGenexSequence &root = nonEvaledValue.getRoot();
     size_t elementIndex = 0;
-    bool isPrefixMatched = false;
     std::vector<size_t> elementIndicesToRemove = {};
-    for (size_t positionInNonEvaled = 0; positionInNonEvaled < nonEvaledValue.length(); positionInNonEvaled++) {
-        const char currentChar = nonEvaledValue[positionInNonEvaled];
-        const char previousChar = positionInNonEvaled > 0 ? nonEvaledValue[positionInNonEvaled - 1] : '\0';
-
-        // Update regex depth
-        if (previousChar == '$' && currentChar == '<') {
-            genexDepth++;
-            continue;
-        }
-        if (previousChar != '\\' && currentChar == '>') {
-            if (genexDepth == 0) {
-                // Malformed genex, don't try to save it
-                return;
-            }
-
-            genexDepth--;
-            if (genexDepth == 0 && isPrefixMatched) {
-                elementIndicesToRemove.push_back(elementIndex);
-                isPrefixMatched = false;
-            }
-            continue;
-        }
-
-        // Update element index
-        if (previousChar != '\\' && currentChar == ';' && genexDepth == 0) {
+    for (size_t nodeIndex = 0; nodeIndex < root.nodesCount; nodeIndex++) {
+        const CmagGenexNode &node = nonEvaledValue.getNode(root, nodeIndex);
+        if (node.type == CmagGenexNodeType::ListSeparator) {
             elementIndex++;
             continue;
         }
 
-        // Check if we're inside our cursed genex
-        if (positionInNonEvaled >= prefixLength && genexDepth == 1 && !isPrefixMatched) {
-            std::string_view currentPrefix = nonEvaledValue.substr(positionInNonEvaled - prefixLength, prefixLength);
-            if (prefix == currentPrefix) {
-                isPrefixMatched = true;
-            }
+        const bool isLinkOnly = node.type == CmagGenexNodeType::Genex &&
+                                nonEvaledValue.getGenexName(node) == "LINK_ONLY" &&
+                                nonEvaledValue.getGenexParametersCount(node) > 0 &&
+                                nonEvaledValue.getGenexParameter(node, 0).nodesCount > 0;
+        if (isLinkOnly && (elementIndicesToRemove.empty() || elementIndicesToRemove.back() != elementIndex)) {
+            elementIndicesToRemove.push_back(elementIndex);
         }
     }
 
-    // Remove all entries with detected $<LINK_ONLY> genex by their index
+    // Remove all entries with detected $<LINK_ONLY> genex by their index. Indices are sorted, so we can
+    // copy remaining entries to a new string in a single pass.
+    if (elementIndicesToRemove.empty()) {
+        return false;
+    }
+    std::string &result = outFixedValue;
+    result.clear();
+    result.reserve(evaledValue.size());
+    auto indexToRemoveIt = elementIndicesToRemove.begin();
     elementIndex = 0;
     size_t elementStartPosition = 0;
-    for (size_t positionInEvaled = 0; positionInEvaled < evaledValue.length() + 1; positionInEvaled++) {
-        const char currentChar = evaledValue.data()[positionInEvaled];
-        if (currentChar != ';' && currentChar != '\0') {
-            continue;
-        }
-
-        if (std::find(elementIndicesToRemove.begin(), elementIndicesToRemove.end(), elementIndex) != elementIndicesToRemove.end()) {
-            std::size_t removeStart = elementStartPosition;
-            std::size_t removeEnd = positionInEvaled;
-            if (removeStart > 0 && evaledValue[removeStart - 1] == ';') {
-                removeStart--;
-            } else if (removeEnd < evaledValue.length() - 1 && evaledValue[removeEnd] == ';') {
-                removeEnd++;
-            }
-            evaledValue.erase(removeStart, removeEnd - removeStart);
-
-            positionInEvaled = elementStartPosition;
+    bool separatorNeeded = false;
+    while (elementStartPosition <= evaledValue.size()) {
+        const char *separator = static_cast<const char *>(std::memchr(evaledValue.data() + elementStartPosition, ';', evaledValue.size() - elementStartPosition));
+        const size_t elementEndPosition = separator != nullptr ? static_cast<size_t>(separator - evaledValue.data()) : evaledValue.size();
+
+        const bool removeElement = indexToRemoveIt != elementIndicesToRemove.end() && *indexToRemoveIt == elementIndex;
+        if (removeElement) {
+            ++indexToRemoveIt;
         } else {
-            elementStartPosition = positionInEvaled + 1;
+            if (separatorNeeded) {
+                result.push_back(';');
+            }
+            result.append(evaledValue.substr(elementStartPosition, elementEndPosition - elementStartPosition));
+            separatorNeeded = true;
         }
 
+        elementStartPosition = elementEndPosition + 1;
         elementIndex++;
     }
+    return true;
 }
-void CmagTargetConfig::deriveData(const CmagTarget &owningTarget, std::vector<CmagTarget> &targets) {
-    derived = {};
 
-    auto addTargetsToVector = [&](std::vector<std::string_view> &strings, std::vector<const CmagTarget *> &outList) {
+void CmagTargetConfig::deriveData(const CmagTarget &owningTarget, const CmagProject &project) {
+    auto addTargetsToVector = [&](const StringSplitRange &strings, std::vector<const CmagTarget *> &outList) {
         for (std::string_view string : strings) {
-            auto it = std::find_if(targets.begin(), targets.end(), [string](const CmagTarget &target) {
-                return target.matchesName(string);
-            });
-
-            if (it != targets.end()) {
-                CmagTarget *dependency = &*it;
-
+            const CmagTarget *dependency = project.findTargetByName(string);
+            if (dependency != nullptr) {
                 if (&owningTarget == dependency) {
                     continue;
                 }
 
-                dependency->derived.isReferenced = true;
                 this->derived.allDependencies.push_back(dependency);
                 outList.push_back(dependency);
             } else {
@@ -298,19 +632,16 @@ void CmagTargetConfig::deriveData(const CmagTarget &owningTarget, std::vector<Cm
         }
     };
 
-    if (auto property = findProperty("LINK_LIBRARIES"); property != nullptr) {
-        std::vector<std::string_view> dependencies = splitCmakeListString(property->value, false);
-        addTargetsToVector(dependencies, derived.buildDependencies);
+    if (auto property = findProperty(CmagPropertyId::LinkLibraries); property != nullptr) {
+        addTargetsToVector(iterateCmakeListString(property->getValue(), false), derived.buildDependencies);
     }
 
-    if (auto property = findProperty("INTERFACE_LINK_LIBRARIES"); property != nullptr) {
-        std::vector<std::string_view> dependencies = splitCmakeListString(property->value, false);
-        addTargetsToVector(dependencies, derived.interfaceDependencies);
+    if (auto property = findProperty(CmagPropertyId::InterfaceLinkLibraries); property != nullptr) {
+        addTargetsToVector(iterateCmakeListString(property->getValue(), false), derived.interfaceDependencies);
     }
 
-    if (auto property = findProperty("MANUALLY_ADDED_DEPENDENCIES"); property != nullptr) {
-        std::vector<std::string_view> dependencies = splitCmakeListString(property->value, false);
-        addTargetsToVector(dependencies, derived.manualDependencies);
+    if (auto property = findProperty(CmagPropertyId::ManuallyAddedDependencies); property != nullptr) {
+        addTargetsToVector(iterateCmakeListString(property->getValue(), false), derived.manualDependencies);
     }
 }
 
@@ -334,6 +665,53 @@ const CmagTargetProperty *CmagTargetConfig::findProperty(std::string_view proper
     return nullptr;
 }
 
+void CmagTargetConfig::deriveDataPropertyIndices(CmagPropertyNameTable &propertyNames) {
+    derived = {};
+    derived.propertyIndices.assign(propertyNames.size(), 0u);
+    for (size_t propertyIndex = 0u; propertyIndex < properties.size(); propertyIndex++) {
+        const CmagTargetProperty &property = properties[propertyIndex];
+        const auto propertyId = static_cast<size_t>(propertyNames.intern(property.name));
+        if (propertyId >= derived.propertyIndices.size()) {
+            derived.propertyIndices.resize(propertyNames.size(), 0u);
+        }
+
+        // In case of duplicated properties, the first one is used, just like in the string-based lookup.
+        uint32_t &entry = derived.propertyIndices[propertyId];
+        if (entry == 0u) {
+            entry = static_cast<uint32_t>(propertyIndex + 1);
+        }
+    }
+}
+
+void CmagTargetConfig::internPropertyStrings(CmagPropertyNameTable &propertyNames, CmagPropertyValueTable &propertyValues) {
+    for (CmagTargetProperty &property : properties) {
+        property.name = propertyNames.getName(propertyNames.intern(property.name));
+
+        // Values already pointing to the table are skipped without hashing them.
+        if (!propertyValues.isStoredValue(property.value, property.valueId)) {
+            property.valueId = propertyValues.intern(property.value);
+            property.value = propertyValues.getValue(property.valueId);
+        }
+    }
+}
+
+CmagTargetProperty *CmagTargetConfig::findProperty(CmagPropertyId propertyId) {
+    const auto constThis = static_cast<const CmagTargetConfig *>(this);
+    return const_cast<CmagTargetProperty *>(constThis->findProperty(propertyId));
+}
+
+const CmagTargetProperty *CmagTargetConfig::findProperty(CmagPropertyId propertyId) const {
+    const auto propertyIdIndex = static_cast<size_t>(propertyId);
+    if (propertyIdIndex >= derived.propertyIndices.size()) {
+        return nullptr;
+    }
+    const uint32_t entry = derived.propertyIndices[propertyIdIndex];
+    if (entry == 0u) {
+        return nullptr;
+    }
+    return &properties[entry - 1];
+}
+
 const CmagTargetConfig *CmagTarget::tryGetConfig(std::string_view configName) const {
     auto configIt = std::find_if(configs.begin(), configs.end(), [configName](const auto &config) {
         return configName == config.name;
@@ -372,39 +750,100 @@ void CmagGlobals::deriveGenerator() {
     }
 }
 
+bool CmagGlobals::deriveDataForTarget(const std::vector<CmagTarget> &targets, size_t targetIndex) {
+    return deriveDataListDirsForTarget(targets, targetIndex) && deriveDataFoldersForTarget(targets, targetIndex);
+}
+
+bool CmagGlobals::deriveDataListDirsForTarget(const std::vector<CmagTarget> &targets, size_t targetIndex) {
+    const CmagTarget &target = targets[targetIndex];
+
+    std::optional<size_t> newListDirIndex = {};
+    if (auto it = derived.listDirIndicesByName.find(target.listDirName); it != derived.listDirIndicesByName.end()) {
+        newListDirIndex = it->second;
+    }
+    std::optional<size_t> &listDirIndex = derived.listDirIndicesByTarget[targetIndex];
+    if (listDirIndex == newListDirIndex) {
+        return listDirIndex.has_value();
+    }
+
+    // Target indices are always sorted, so we can use bisection to find our target.
+    if (listDirIndex.has_value()) {
+        std::vector<size_t> &targetIndices = listDirs[listDirIndex.value()].derived.targetIndices;
+        auto it = std::lower_bound(targetIndices.begin(), targetIndices.end(), targetIndex);
+        if (it != targetIndices.end() && *it == targetIndex) {
+            targetIndices.erase(it);
+        }
+    }
+    if (newListDirIndex.has_value()) {
+        std::vector<size_t> &targetIndices = listDirs[newListDirIndex.value()].derived.targetIndices;
+        auto it = std::lower_bound(targetIndices.begin(), targetIndices.end(), targetIndex);
+        targetIndices.insert(it, targetIndex);
+    }
+    listDirIndex = newListDirIndex;
+    return listDirIndex.has_value();
+}
+
+bool CmagGlobals::deriveDataFoldersForTarget(const std::vector<CmagTarget> &targets, size_t targetIndex) {
+    const CmagTargetProperty *property = targets[targetIndex].getPropertyValue(CmagPropertyId::Folder);
+    if (property != nullptr && !property->isConsistent) {
+        return false;
+    }
+
+    // Find the folder in which the target should be. If the target is already there, there's nothing to do.
+    std::optional<size_t> folderIndex = 0;
+    if (property != nullptr && !property->getValue().empty()) {
+        auto it = derived.folderIndicesByPath.find(std::string{property->getValue()});
+        if (it == derived.folderIndicesByPath.end()) {
+            folderIndex.reset();
+        } else {
+            folderIndex = it->second;
+        }
+    }
+    if (folderIndex.has_value()) {
+        const std::vector<size_t> &targetIndices = derived.folders[folderIndex.value()].targetIndices;
+        if (std::binary_search(targetIndices.begin(), targetIndices.end(), targetIndex)) {
+            return true;
+        }
+    }
+
+    // The target has been moved to a different folder. Rebuild the whole hierarchy, so it's exactly the same as
+    // after a full derivation, e.g. folders which became empty must disappear.
+    return deriveDataFolders(targets);
+}
+
 bool CmagGlobals::deriveDataListDirs(const std::vector<CmagTarget> &targets) {
-    for (CmagListDir &listDir : listDirs) {
+    derived.listDirIndicesByName.clear();
+    derived.listDirIndicesByName.reserve(listDirs.size());
+    for (size_t listDirIndex = 0u; listDirIndex < listDirs.size(); listDirIndex++) {
+        CmagListDir &listDir = listDirs[listDirIndex];
         listDir.derived = {};
+        derived.listDirIndicesByName.emplace(listDir.name, listDirIndex); // if names repeat, the first one wins
     }
 
+    derived.listDirIndicesByTarget.assign(targets.size(), std::nullopt);
     for (size_t targetIndex = 0u; targetIndex < targets.size(); targetIndex++) {
         const CmagTarget &target = targets[targetIndex];
 
-        bool found = false;
-        for (CmagListDir &listDir : listDirs) {
-            if (listDir.name != target.listDirName) {
-                continue;
-            }
-
-            listDir.derived.targetIndices.push_back(targetIndex);
-            found = true;
-            break;
-        }
-
-        if (!found) {
+        auto it = derived.listDirIndicesByName.find(target.listDirName);
+        if (it == derived.listDirIndicesByName.end()) {
             return false;
         }
+
+        listDirs[it->second].derived.targetIndices.push_back(targetIndex);
+        derived.listDirIndicesByTarget[targetIndex] = it->second;
     }
 
     return true;
 }
 
 bool CmagGlobals::deriveDataFolders(const std::vector<CmagTarget> &targets) {
+    derived.folders.clear();
+    derived.folderIndicesByPath.clear();
     derived.folders.push_back(CmagFolder{"", ""});
 
     for (size_t targetIndex = 0u; targetIndex < targets.size(); targetIndex++) {
         const CmagTarget &target = targets[targetIndex];
-        const CmagTargetProperty *property = target.getPropertyValue("FOLDER");
+        const CmagTargetProperty *property = target.getPropertyValue(CmagPropertyId::Folder);
         if (property == nullptr) {
             derived.folders[0].targetIndices.push_back(targetIndex);
             continue;
@@ -412,33 +851,26 @@ bool CmagGlobals::deriveDataFolders(const std::vector<CmagTarget> &targets) {
         if (!property->isConsistent) {
             return false;
         }
-        const std::vector<std::string_view> folders = splitStringByChar(property->value, false, '/');
-        insertDerivedTargetWithFolder(targetIndex, folders);
+        insertDerivedTargetWithFolder(targetIndex, property->getValue());
     }
     return true;
 }
 
-void CmagGlobals::insertDerivedTargetWithFolder(size_t targetIndex, const std::vector<std::string_view> &folders) {
+void CmagGlobals::insertDerivedTargetWithFolder(size_t targetIndex, std::string_view folderPath) {
     // Initialize the current folder we are looking at. Zero is the root folder.
     size_t currentFolderIndex = 0;
 
-    // Find leaf folder containing the target
-    for (std::string_view currentTargetFolderName : folders) {
-        // Get index of the child folder
-        std::optional<size_t> matchingChildIndex = {};
-        for (size_t childIndex : derived.folders[currentFolderIndex].childIndices) {
-            if (derived.folders[childIndex].relativeName == currentTargetFolderName) {
-                matchingChildIndex = childIndex;
-                break;
-            }
-        }
+    // Find leaf folder containing the target. Folders are identified by the prefix of the path ending at their name,
+    // so each level is a single hash lookup.
+    for (std::string_view currentTargetFolderName : iterateStringByChar(folderPath, false, '/')) {
+        const size_t prefixLength = static_cast<size_t>(currentTargetFolderName.data() - folderPath.data()) + currentTargetFolderName.size();
+        const std::string_view currentFolderPath = folderPath.substr(0, prefixLength);
 
-        // If index of child folder was not found, we have to create it
-        if (!matchingChildIndex.has_value()) {
+        // Get index of the child folder. If it was not found, we have to create it
+        auto [childIt, isNewFolder] = derived.folderIndicesByPath.try_emplace(std::string{currentFolderPath}, derived.folders.size());
+        if (isNewFolder) {
             CmagFolder &currentFolder = derived.folders[currentFolderIndex];
-
-            matchingChildIndex = derived.folders.size();
-            currentFolder.childIndices.push_back(matchingChildIndex.value());
+            currentFolder.childIndices.push_back(childIt->second);
 
             std::string relativeName = std::string(currentTargetFolderName);
             std::string fullName;
@@ -451,16 +883,16 @@ void CmagGlobals::insertDerivedTargetWithFolder(size_t targetIndex, const std::v
         }
 
         // Advance to the child folder
-        currentFolderIndex = matchingChildIndex.value();
+        currentFolderIndex = childIt->second;
     }
 
     // Assign target's index to the folder
     derived.folders[currentFolderIndex].targetIndices.push_back(targetIndex);
 }
 
-void CmagTarget::deriveData(std::vector<CmagTarget> &targets) {
+void CmagTarget::deriveData(const CmagProject &project) {
     for (CmagTargetConfig &config : configs) {
-        config.deriveData(*this, targets);
+        config.deriveData(*this, project);
     }
     deriveDataPropertyConsistency();
 }
@@ -470,52 +902,45 @@ void CmagTarget::deriveDataPropertyConsistency() {
         return;
     }
 
-    std::vector<CmagTargetProperty *> cachedProperties(configs.size());
-
-    // This loop is written with the assumption that all configs contain the same properties. W
-    // will loop through properties of a zeroth config and assume they will also be found on other
-    // configs.
-    // It may work incorrectly if they are different. This scenario could happen only when merging
-    // multiple single-generator projects.
-    // TODO: disallow different properties for configs in cmag --merge
-    CmagTargetConfig &defaultConfig = configs[0];
-    for (auto &defaultConfigProperty : defaultConfig.properties) {
-        std::fill(cachedProperties.begin(), cachedProperties.end(), nullptr);
-        cachedProperties[0] = &defaultConfigProperty;
-
-        // Search for the same property in rest of configs and verify whether they are the same
+    // Each property is processed as one row spanning all configs. A property is consistent, if all configs have it
+    // with the same value id. A property missing in some of the configs shouldn't happen for correctly generated
+    // cmag projects, but it could when merging multiple single-generator projects. Such property is inconsistent.
+    size_t propertyIdsCount = 0u;
+    for (const CmagTargetConfig &config : configs) {
+        propertyIdsCount = std::max(propertyIdsCount, config.derived.propertyIndices.size());
+    }
+    std::vector<CmagTargetProperty *> row(configs.size());
+    for (size_t propertyId = 0u; propertyId < propertyIdsCount; propertyId++) {
+        bool isPresent = false;
         bool isConsistent = true;
-        for (size_t configIndex = 1u; configIndex < configs.size(); configIndex++) {
-            CmagTargetProperty *currentConfigProperty = configs[configIndex].findProperty(defaultConfigProperty.name);
-            cachedProperties[configIndex] = currentConfigProperty;
-
-            // this situation shouldn't normally happen for correctly generated cmag projects, but let's
-            // handle it to be robust.
-            if (currentConfigProperty == nullptr) {
-                isConsistent = false;
-                continue;
-            }
-
-            if (defaultConfigProperty.value != currentConfigProperty->value) {
-                isConsistent = false;
-            }
+        for (size_t configIndex = 0u; configIndex < configs.size(); configIndex++) {
+            CmagTargetProperty *property = configs[configIndex].findProperty(static_cast<CmagPropertyId>(propertyId));
+            row[configIndex] = property;
+            isPresent = isPresent || property != nullptr;
+            isConsistent = isConsistent && property != nullptr && property->valueId == row[0]->valueId;
+        }
+        if (!isPresent) {
+            continue;
         }
 
-        // Set the boolean value for cachedProperties of all configs.
-        for (CmagTargetProperty *property : cachedProperties) {
-            if (property == nullptr) {
-                continue;
+        for (CmagTargetProperty *property : row) {
+            if (property != nullptr) {
+                property->isConsistent = isConsistent;
             }
-            property->isConsistent = isConsistent;
         }
     }
 }
+
 const CmagTargetProperty *CmagTarget::getPropertyValue(std::string_view propertyName) const {
     // Select any config. User of this method should check whether the acquired property
     // is consistent.
     return configs[0].findProperty(propertyName);
 }
 
+const CmagTargetProperty *CmagTarget::getPropertyValue(CmagPropertyId propertyId) const {
+    return configs[0].findProperty(propertyId);
+}
+
 bool CmagTarget::isIgnoredImportedTarget() const {
     return isImported && !derived.isReferenced;
 }
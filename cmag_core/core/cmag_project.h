@@ -1,9 +1,18 @@
 #pragma once
 
+#include "cmag_core/core/dependency_graph.h"
+#include "cmag_core/core/dependency_reachability.h"
+#include "cmag_core/core/genex.h"
+#include "cmag_core/core/property_name_table.h"
+#include "cmag_core/core/property_value_table.h"
 #include "cmag_core/core/version.h"
-#include "cmag_core/utils/enum_utils.h"
 
+#include <memory>
+#include <memory_resource>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -27,18 +36,6 @@ enum class CmagTargetType {
 };
 const char *cmagTargetTypeToString(CmagTargetType type);
 
-enum class CmagDependencyType {
-    Build = 1,
-    Interface = 2,
-    Additional = 4,
-
-    NONE = 0,
-    COUNT = 3,
-    DEFAULT = Build | Additional,
-};
-
-BITFIELD_ENUM(CmagDependencyType)
-
 struct CmagFolder {
     // These structures are built based on values of FOLDER CMake property of all the target in
     // the project. There are no global list of the folders, so we derive their structure from
@@ -88,6 +85,9 @@ struct CmagGlobals {
     struct {
         const CMakeGenerator *generator = {};
         std::vector<CmagFolder> folders = {};
+        std::unordered_map<std::string, size_t> listDirIndicesByName = {};
+        std::vector<std::optional<size_t>> listDirIndicesByTarget = {}; // indexed with target index
+        std::unordered_map<std::string, size_t> folderIndicesByPath = {}; // keyed by FOLDER property value, root folder is not stored
     } derived = {};
 
 private:
@@ -96,13 +96,24 @@ private:
     bool deriveData(const std::vector<CmagTarget> &targets);
     bool deriveDataListDirs(const std::vector<CmagTarget> &targets);
     bool deriveDataFolders(const std::vector<CmagTarget> &targets);
-    void insertDerivedTargetWithFolder(size_t targetIndex, const std::vector<std::string_view> &folders);
+    bool deriveDataForTarget(const std::vector<CmagTarget> &targets, size_t targetIndex);
+    bool deriveDataListDirsForTarget(const std::vector<CmagTarget> &targets, size_t targetIndex);
+    bool deriveDataFoldersForTarget(const std::vector<CmagTarget> &targets, size_t targetIndex);
+    void insertDerivedTargetWithFolder(size_t targetIndex, std::string_view folderPath);
 };
 
+// Names and values of properties are stored by the project. There are a lot of them and most of them repeat, so the
+// project keeps each distinct string only once in its property tables and properties are views into them. Before a
+// target is added to a project, its properties can point to any memory, e.g. string literals or temporary buffers of
+// a parser. The memory has to be valid only until the target is added, because adding interns all the strings.
+// Properties modified in place are interned again by the next derivation.
 struct CmagTargetProperty {
-    std::string name = {};
-    std::string value = {};
+    std::string_view name = {};
+    std::string_view value = {};
     bool isConsistent = true; // true if this property has the same value for all other configs
+    CmagPropertyValueId valueId = CmagPropertyValueId::Invalid; // equal values have equal ids, set when interned
+
+    std::string_view getValue() const { return value; }
 };
 
 struct CmagTargetConfig {
@@ -115,17 +126,25 @@ struct CmagTargetConfig {
         std::vector<const CmagTarget *> manualDependencies = {};    // based on MANUALLY_ADDED_DEPENDENCIES
         std::vector<const CmagTarget *> allDependencies = {};
         std::vector<std::string> unmatchedDependencies = {};
+        std::vector<uint32_t> propertyIndices = {}; // indexed with CmagPropertyId, 0 means no property, otherwise index+1
     } derived = {};
 
-    void deriveData(const CmagTarget &owningTarget, std::vector<CmagTarget> &targets);
-    void fixupWithNonEvaled(std::string_view propertyName, std::string_view nonEvaledValue);
+    void deriveData(const CmagTarget &owningTarget, const CmagProject &project); // requires property indices
+    // Fixed values are allocated from the memory resource, which has to be valid until the target is added to a project.
+    void fixupWithNonEvaled(std::string_view propertyName, std::string_view nonEvaledValue, std::pmr::memory_resource *memoryResource);
+    void fixupWithNonEvaled(std::string_view propertyName, std::string_view nonEvaledValue, std::pmr::memory_resource *memoryResource, CmagGenexCache &genexCache);
     CmagTargetProperty *findProperty(std::string_view propertyName);
     const CmagTargetProperty *findProperty(std::string_view propertyName) const;
+    CmagTargetProperty *findProperty(CmagPropertyId propertyId);             // requires derived data
+    const CmagTargetProperty *findProperty(CmagPropertyId propertyId) const; // requires derived data
 
 private:
     friend CmagTarget;
-    static void fixupLinkLibrariesDirectoryId(std::string &value);
-    static void fixupLinkLibrariesGenex(CmagTargetProperty &property, std::string_view nonEvaledValue);
+    friend CmagProject;
+    void internPropertyStrings(CmagPropertyNameTable &propertyNames, CmagPropertyValueTable &propertyValues);
+    void deriveDataPropertyIndices(CmagPropertyNameTable &propertyNames);
+    static bool fixupLinkLibrariesDirectoryId(std::string_view value, std::string &outFixedValue);
+    static bool fixupLinkLibrariesGenex(std::string_view evaledValue, const CmagGenexTree &nonEvaledValue, std::string &outFixedValue);
 };
 
 struct CmagTargetGraphicalData {
@@ -145,30 +164,59 @@ struct CmagTarget {
     std::vector<std::string> aliases = {};
     struct {
         bool isReferenced = false; // whether this target is a dependency of some other target
+        size_t referencesCount = 0; // how many times this target is a dependency of other targets, counted separately for each config
     } derived = {};
 
     const CmagTargetConfig *tryGetConfig(std::string_view configName) const;
     CmagTargetConfig &getOrCreateConfig(std::string_view configName);
     const CmagTargetProperty *getPropertyValue(std::string_view propertyName) const;
+    const CmagTargetProperty *getPropertyValue(CmagPropertyId propertyId) const; // requires derived data
     bool isIgnoredImportedTarget() const;
     bool matchesName(std::string_view nameToMatch) const;
 
 private:
     friend CmagProject;
-    void deriveData(std::vector<CmagTarget> &targets);
+    void deriveData(const CmagProject &project);
     void deriveDataPropertyConsistency();
 };
 
 using CmagConfigs = std::vector<std::string>;
 
+// Copy of the project data, which can be modified by the browser. Everything else stays constant after the project
+// is loaded, so the project together with this snapshot can be safely serialized on another thread.
+struct CmagBrowserStateSnapshot {
+    bool darkMode = false;
+    std::string selectedConfig = {};
+    CmagGlobals::BrowserData browser = {};
+    std::vector<CmagTargetGraphicalData> targetsGraphical = {}; // indexed the same as targets of the project
+};
+
 class CmagProject {
 public:
-    CmagProject() = default;
+    CmagProject() : CmagProject(std::pmr::get_default_resource()) {}
+    explicit CmagProject(std::pmr::memory_resource *upstreamMemoryResource);
+    CmagProject(CmagProject &&) = default;
+    CmagProject &operator=(CmagProject &&) = delete; // would release the memory resource while old data is still using it
 
-    bool addTarget(CmagTarget &&newTarget);
+    bool addTarget(CmagTarget &&newTarget); // interns strings of the properties, so they don't have to be valid afterwards
     bool addTargetAlias(std::string_view aliasName, std::string_view aliasedTargetName);
 
-    bool deriveData();
+    // Multithreaded derivation yields exactly the same results as the single-threaded one. Threads are spawned
+    // only for projects big enough to benefit from them, so callers can always enable it.
+    bool deriveData(bool multithreaded = false);
+
+    // Incremental derivation. After modifying a target, it can be marked as dirty. Then deriveDirtyData() will
+    // recalculate only the dirty targets and the data depending on them. Configs of a target should be replaced
+    // with replaceTargetConfigs(), because dirty marking needs the previously derived data. New configs are interned
+    // just like in addTarget(). Only strings of the dirty targets are interned again. Adding targets or
+    // aliases invalidates everything, so deriveDirtyData() will fall back to full derivation.
+    bool markTargetDirty(std::string_view targetName);
+    bool replaceTargetConfigs(std::string_view targetName, std::vector<CmagTargetConfig> &&newConfigs);
+    bool deriveDirtyData();
+
+    CmagTarget *findTargetByName(std::string_view nameOrAlias);
+    const CmagTarget *findTargetByName(std::string_view nameOrAlias) const;
+    CmagBrowserStateSnapshot createBrowserStateSnapshot() const;
 
     const auto &getConfigs() const { return configs; }
     const auto &getTargets() const { return targets; }
@@ -176,16 +224,68 @@ public:
     const auto &getGlobals() const { return globals; }
     auto &getGlobals() { return globals; }
     const auto &getUnmatchedDependencies() const { return derived.unmatchedDependencies; }
+    const std::vector<size_t> *findUnmatchedDependencyTargetIndices(std::string_view dependencyName) const;
+    const CmagDependencyGraph *findDependencyGraph(std::string_view configName) const; // requires derived data
+
+    // Components and reachability are calculated lazily for each config and set of dependency types. They are cached
+    // until the next full derivation. Incremental derivation keeps them, unless edges of their config and dependency
+    // types have changed. Caching makes these methods not thread-safe.
+    const CmagDependencyComponents *getDependencyComponents(std::string_view configName, CmagDependencyType types) const;     // requires derived data
+    const CmagDependencyReachability *getDependencyReachability(std::string_view configName, CmagDependencyType types) const; // requires derived data
+    std::pmr::memory_resource *getMemoryResource() const { return memoryResource.get(); }
+    std::string_view storeRawData(std::string_view data); // copies data to the project memory, valid until the project is destroyed
+    std::pmr::memory_resource *createMemoryResource();    // additional resource owned by the project, e.g. for another thread
+    const auto &getPropertyNames() const { return propertyNames; }
+    auto &getPropertyNames() { return propertyNames; }
+    const auto &getPropertyValues() const { return propertyValues; }
+    auto &getPropertyValues() { return propertyValues; }
 
 private:
-    void deriveUnmatchedDependencies();
+    void deriveTargets(bool multithreaded);
+    void internPropertyStrings(CmagTarget &target);
+    void deriveDependencyReferences();
+    void deriveDependencyGraphs();
+    void updateDependencyGraphs();
+    void collectDependencyGraphEdges(const CmagTarget &target, size_t configIndex, std::vector<CmagDependencyGraph::Edge> &outEdges) const;
+    void addDependencyReferences(const CmagTarget &target);
+    void removeDependencyReferences(const CmagTarget &target);
     static bool mergeTargets(CmagTarget &dst, CmagTarget &&src);
     void addConfig(std::string_view config);
+    void addTargetName(std::string_view name, size_t targetIndex);
 
+    // Monotonic memory resource used for data loaded into the project. It never frees memory until the project is
+    // destroyed, so loading becomes a few big allocations. It has to be declared first, to be destroyed last. It's not
+    // thread-safe, so additional resources can be created for loading on multiple threads.
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> memoryResource;
+    std::vector<std::unique_ptr<std::pmr::monotonic_buffer_resource>> additionalMemoryResources;
     CmagConfigs configs = {};
     CmagGlobals globals = {};
     std::vector<CmagTarget> targets = {};
+    // Both names and aliases of targets are stored here. Keys are views into the project memory, so lookups by views
+    // don't allocate.
+    std::unordered_map<std::string_view, size_t> targetIndicesByName = {};
+    CmagPropertyNameTable propertyNames = {};
+    CmagPropertyValueTable propertyValues; // stored in the project memory
+    bool needsFullDerive = true;
+    std::vector<size_t> dirtyTargetIndices = {};
+    struct DependencyAnalysis {
+        std::unique_ptr<CmagDependencyComponents> components;
+        std::unique_ptr<CmagDependencyReachability> reachability;
+    };
+    DependencyAnalysis *getDependencyAnalysis(std::string_view configName, CmagDependencyType types) const;
+    // All combinations of dependency types fit below this value, so it can be used to index the cache.
+    constexpr static size_t dependencyTypesCombinationsCount = size_t{1} << static_cast<size_t>(CmagDependencyType::COUNT);
+
+    struct UnmatchedDependencyReferences {
+        size_t count = 0;                       // counted separately for each config
+        std::vector<size_t> targetIndices = {}; // sorted, each referencing target is stored once
+    };
+    void removeUnreferencedUnmatchedDependencies();
     struct {
-        std::vector<std::string> unmatchedDependencies;
+        std::vector<std::string> unmatchedDependencies; // in order of first reference
+        std::unordered_map<std::string, UnmatchedDependencyReferences> unmatchedDependencyReferences;
+        bool hasUnreferencedUnmatchedDependencies = false; // entries with zero count, which are yet to be removed
+        std::vector<CmagDependencyGraph> dependencyGraphs; // indexed the same as configs
+        mutable std::vector<DependencyAnalysis> dependencyAnalyses; // indexed with config index and dependency types
     } derived;
 };
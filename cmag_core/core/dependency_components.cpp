@@ -0,0 +1,115 @@
+#include "dependency_components.h"
+
+#include <algorithm>
+
+CmagDependencyComponents::CmagDependencyComponents(const CmagDependencyGraph &graph, CmagDependencyType types)
+    : types(types) {
+    deriveComponents(graph);
+    deriveComponentEdges(graph);
+}
+
+void CmagDependencyComponents::deriveComponents(const CmagDependencyGraph &graph) {
+    // Iterative Tarjan's algorithm, because dependency chains can be deep enough to overflow the call stack. A component
+    // is completed only after all components reachable from it, so they are numbered in reverse topological order.
+    const size_t targetsCount = graph.getTargetsCount();
+    constexpr uint32_t unvisited = UINT32_MAX;
+    std::vector<uint32_t> visitIndices(targetsCount, unvisited);
+    std::vector<uint32_t> lowLinks(targetsCount, 0);
+    std::vector<uint8_t> onStack(targetsCount, 0);
+    std::vector<uint32_t> stack = {};
+    struct Frame {
+        uint32_t targetIndex;
+        uint32_t nextEdgeIndex;
+    };
+    std::vector<Frame> callStack = {};
+    uint32_t nextVisitIndex = 0;
+
+    componentsByTarget.assign(targetsCount, 0);
+    componentTargets.clear();
+    componentTargets.reserve(targetsCount);
+    componentTargetOffsets = {0};
+    componentCyclic.clear();
+
+    auto visit = [&](uint32_t targetIndex) {
+        visitIndices[targetIndex] = nextVisitIndex;
+        lowLinks[targetIndex] = nextVisitIndex;
+        nextVisitIndex++;
+        stack.push_back(targetIndex);
+        onStack[targetIndex] = 1;
+        callStack.push_back(Frame{targetIndex, 0});
+    };
+
+    for (size_t rootIndex = 0; rootIndex < targetsCount; rootIndex++) {
+        if (visitIndices[rootIndex] != unvisited) {
+            continue;
+        }
+        visit(static_cast<uint32_t>(rootIndex));
+
+        while (!callStack.empty()) {
+            Frame &frame = callStack.back();
+            const CmagDependencyGraph::EdgeRange edges = graph.getDependencies(frame.targetIndex);
+            if (frame.nextEdgeIndex < edges.size()) {
+                const CmagDependencyGraph::Edge &edge = edges.begin()[frame.nextEdgeIndex++];
+                if (!hasCmagDependencyTypeBit(edge.types, types)) {
+                    continue;
+                }
+                if (visitIndices[edge.targetIndex] == unvisited) {
+                    visit(edge.targetIndex); // invalidates the frame reference
+                } else if (onStack[edge.targetIndex]) {
+                    lowLinks[frame.targetIndex] = std::min(lowLinks[frame.targetIndex], visitIndices[edge.targetIndex]);
+                }
+                continue;
+            }
+
+            // All dependencies are visited, propagate the low link to the parent and pop the component if this
+            // target is its root.
+            const uint32_t targetIndex = frame.targetIndex;
+            callStack.pop_back();
+            if (!callStack.empty()) {
+                const uint32_t parentIndex = callStack.back().targetIndex;
+                lowLinks[parentIndex] = std::min(lowLinks[parentIndex], lowLinks[targetIndex]);
+            }
+            if (lowLinks[targetIndex] != visitIndices[targetIndex]) {
+                continue;
+            }
+
+            const auto component = static_cast<uint32_t>(componentCyclic.size());
+            uint32_t memberIndex = 0;
+            do {
+                memberIndex = stack.back();
+                stack.pop_back();
+                onStack[memberIndex] = 0;
+                componentsByTarget[memberIndex] = component;
+                componentTargets.push_back(memberIndex);
+            } while (memberIndex != targetIndex);
+            componentTargetOffsets.push_back(static_cast<uint32_t>(componentTargets.size()));
+            componentCyclic.push_back(componentTargetOffsets[component + 1] - componentTargetOffsets[component] > 1);
+        }
+    }
+}
+
+void CmagDependencyComponents::deriveComponentEdges(const CmagDependencyGraph &graph) {
+    const size_t componentsCount = getComponentsCount();
+    std::vector<uint32_t> lastSourceComponents(componentsCount, UINT32_MAX); // used to skip duplicated edges
+
+    componentEdges.clear();
+    componentEdgeOffsets = {0};
+    for (uint32_t component = 0; component < componentsCount; component++) {
+        for (uint32_t memberOffset = componentTargetOffsets[component]; memberOffset < componentTargetOffsets[component + 1]; memberOffset++) {
+            for (const CmagDependencyGraph::Edge &edge : graph.getDependencies(componentTargets[memberOffset])) {
+                if (!hasCmagDependencyTypeBit(edge.types, types)) {
+                    continue;
+                }
+
+                const uint32_t dstComponent = componentsByTarget[edge.targetIndex];
+                if (dstComponent == component) {
+                    componentCyclic[component] = 1; // covers self loops of single target components
+                } else if (lastSourceComponents[dstComponent] != component) {
+                    lastSourceComponents[dstComponent] = component;
+                    componentEdges.push_back(dstComponent);
+                }
+            }
+        }
+        componentEdgeOffsets.push_back(static_cast<uint32_t>(componentEdges.size()));
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "cmag_core/core/dependency_graph.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Strongly connected components of a dependency graph, following only edges with given dependency types. CMake allows
+// cycles between static libraries, so a component can contain multiple targets depending on each other. Collapsing
+// components yields a DAG, called the condensed graph, which is easier to analyze and lay out.
+class CmagDependencyComponents {
+public:
+    struct IndexRange {
+        const uint32_t *first = nullptr;
+        const uint32_t *last = nullptr;
+
+        const uint32_t *begin() const { return first; }
+        const uint32_t *end() const { return last; }
+        size_t size() const { return static_cast<size_t>(last - first); }
+        bool empty() const { return first == last; }
+    };
+
+    CmagDependencyComponents(const CmagDependencyGraph &graph, CmagDependencyType types);
+
+    CmagDependencyType getTypes() const { return types; }
+    size_t getTargetsCount() const { return componentsByTarget.size(); }
+    size_t getComponentsCount() const { return componentTargetOffsets.size() - 1; }
+    uint32_t getComponent(size_t targetIndex) const { return componentsByTarget[targetIndex]; }
+    IndexRange getComponentTargets(uint32_t component) const { return getRange(componentTargets, componentTargetOffsets, component); }
+    IndexRange getComponentDependencies(uint32_t component) const { return getRange(componentEdges, componentEdgeOffsets, component); }
+
+    // A component is cyclic, if its targets can reach themselves. It's either a component with multiple targets or
+    // a single target depending on itself.
+    bool isComponentCyclic(uint32_t component) const { return componentCyclic[component]; }
+    bool isTargetInCycle(size_t targetIndex) const { return componentCyclic[componentsByTarget[targetIndex]]; }
+
+private:
+    void deriveComponents(const CmagDependencyGraph &graph);
+    void deriveComponentEdges(const CmagDependencyGraph &graph);
+
+    static IndexRange getRange(const std::vector<uint32_t> &values, const std::vector<uint32_t> &offsets, uint32_t index) {
+        const uint32_t *data = values.data();
+        return IndexRange{data + offsets[index], data + offsets[index + 1]};
+    }
+
+    CmagDependencyType types = CmagDependencyType::NONE;
+
+    // Components are numbered in reverse topological order, so edges of the condensed graph always point to
+    // components with lower indices.
+    std::vector<uint32_t> componentsByTarget = {};
+    std::vector<uint32_t> componentTargets = {};       // targets grouped by their components
+    std::vector<uint32_t> componentTargetOffsets = {}; // targets of component i are in range [offsets[i], offsets[i+1])
+    std::vector<uint8_t> componentCyclic = {};
+    std::vector<uint32_t> componentEdges = {}; // condensed graph, without self loops and duplicates
+    std::vector<uint32_t> componentEdgeOffsets = {};
+};
@@ -0,0 +1,133 @@
+#include "dependency_graph.h"
+
+#include <algorithm>
+
+void CmagDependencyGraph::clear() {
+    dependencies.clear();
+    dependencyOffsets.clear();
+    dependents.clear();
+    dependentOffsets.clear();
+}
+
+void CmagDependencyGraph::addTarget(std::vector<Edge> &targetDependencies) {
+    if (dependencyOffsets.empty()) {
+        dependencyOffsets.push_back(0);
+    }
+
+    sortAndMergeEdges(targetDependencies);
+    dependencies.insert(dependencies.end(), targetDependencies.begin(), targetDependencies.end());
+    dependencyOffsets.push_back(static_cast<uint32_t>(dependencies.size()));
+}
+
+CmagDependencyType CmagDependencyGraph::replaceTarget(size_t targetIndex, std::vector<Edge> &targetDependencies) {
+    sortAndMergeEdges(targetDependencies);
+
+    // Both old and new edges are sorted by the target index, so they can be compared in a single pass.
+    CmagDependencyType changedTypes = CmagDependencyType::NONE;
+    const EdgeRange oldEdges = getDependencies(targetIndex);
+    const Edge *oldEdge = oldEdges.begin();
+    const Edge *newEdge = targetDependencies.data();
+    const Edge *newEdgesEnd = newEdge + targetDependencies.size();
+    while (oldEdge != oldEdges.end() || newEdge != newEdgesEnd) {
+        if (newEdge == newEdgesEnd || (oldEdge != oldEdges.end() && oldEdge->targetIndex < newEdge->targetIndex)) {
+            changedTypes = changedTypes | oldEdge->types;
+            oldEdge++;
+        } else if (oldEdge == oldEdges.end() || newEdge->targetIndex < oldEdge->targetIndex) {
+            changedTypes = changedTypes | newEdge->types;
+            newEdge++;
+        } else {
+            changedTypes = changedTypes | (oldEdge->types ^ newEdge->types);
+            oldEdge++;
+            newEdge++;
+        }
+    }
+    if (changedTypes == CmagDependencyType::NONE) {
+        return changedTypes;
+    }
+
+    // Splice the new edges in place of the old ones and shift ranges of all subsequent targets.
+    const uint32_t oldEdgesCount = static_cast<uint32_t>(oldEdges.size());
+    const uint32_t newEdgesCount = static_cast<uint32_t>(targetDependencies.size());
+    const auto oldFirst = dependencies.begin() + dependencyOffsets[targetIndex];
+    const auto insertPosition = dependencies.erase(oldFirst, oldFirst + oldEdgesCount);
+    dependencies.insert(insertPosition, targetDependencies.begin(), targetDependencies.end());
+    for (size_t offsetIndex = targetIndex + 1; offsetIndex < dependencyOffsets.size(); offsetIndex++) {
+        dependencyOffsets[offsetIndex] = dependencyOffsets[offsetIndex] - oldEdgesCount + newEdgesCount;
+    }
+    return changedTypes;
+}
+
+void CmagDependencyGraph::sortAndMergeEdges(std::vector<Edge> &edges) {
+    // Sort by the target index, so duplicated edges are next to each other and can be merged into one.
+    std::sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b) {
+        return a.targetIndex < b.targetIndex;
+    });
+    size_t mergedCount = 0;
+    for (size_t edgeIndex = 0; edgeIndex < edges.size(); edgeIndex++) {
+        const Edge edge = edges[edgeIndex];
+        if (mergedCount > 0 && edges[mergedCount - 1].targetIndex == edge.targetIndex) {
+            edges[mergedCount - 1].types = edges[mergedCount - 1].types | edge.types;
+        } else {
+            edges[mergedCount++] = edge;
+        }
+    }
+    edges.resize(mergedCount);
+}
+
+void CmagDependencyGraph::finalize() {
+    const size_t targetsCount = getTargetsCount();
+
+    // Count dependents of each target and turn the counts into offsets
+    dependentOffsets.assign(targetsCount + 1, 0);
+    for (const Edge &edge : dependencies) {
+        dependentOffsets[edge.targetIndex + 1]++;
+    }
+    for (size_t targetIndex = 0; targetIndex < targetsCount; targetIndex++) {
+        dependentOffsets[targetIndex + 1] += dependentOffsets[targetIndex];
+    }
+
+    // Scatter reversed edges. Sources are visited in increasing order, so dependents of each target end up sorted.
+    dependents.resize(dependencies.size());
+    std::vector<uint32_t> positions{dependentOffsets.begin(), dependentOffsets.end() - 1};
+    for (size_t srcIndex = 0; srcIndex < targetsCount; srcIndex++) {
+        for (const Edge &edge : getDependencies(srcIndex)) {
+            dependents[positions[edge.targetIndex]++] = Edge{static_cast<uint32_t>(srcIndex), edge.types};
+        }
+    }
+}
+
+bool CmagDependencyGraph::hasDependents(size_t targetIndex, CmagDependencyType types) const {
+    const EdgeRange edges = getDependents(targetIndex);
+    return std::any_of(edges.begin(), edges.end(), [types](const Edge &edge) {
+        return hasCmagDependencyTypeBit(edge.types, types);
+    });
+}
+
+void CmagDependencyGraph::collectDependents(size_t targetIndex, CmagDependencyType types, std::vector<uint32_t> &outTargetIndices) const {
+    outTargetIndices.clear();
+    for (const Edge &edge : getDependents(targetIndex)) {
+        if (hasCmagDependencyTypeBit(edge.types, types)) {
+            outTargetIndices.push_back(edge.targetIndex);
+        }
+    }
+}
+
+void CmagDependencyGraph::collectTransitiveDependents(size_t targetIndex, CmagDependencyType types, std::vector<uint32_t> &outTargetIndices) const {
+    outTargetIndices.clear();
+
+    // The output vector doubles as a queue. Cycles are possible, so the starting target can also be its own dependent.
+    std::vector<bool> visited(getTargetsCount(), false);
+    size_t queueStart = 0;
+    auto visitDependents = [&](size_t currentIndex) {
+        for (const Edge &edge : getDependents(currentIndex)) {
+            if (hasCmagDependencyTypeBit(edge.types, types) && !visited[edge.targetIndex]) {
+                visited[edge.targetIndex] = true;
+                outTargetIndices.push_back(edge.targetIndex);
+            }
+        }
+    };
+    visitDependents(targetIndex);
+    while (queueStart < outTargetIndices.size()) {
+        visitDependents(outTargetIndices[queueStart++]);
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "cmag_core/utils/enum_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class CmagDependencyType {
+    Build = 1,
+    Interface = 2,
+    Additional = 4,
+
+    NONE = 0,
+    COUNT = 3,
+    DEFAULT = Build | Additional,
+};
+
+BITFIELD_ENUM(CmagDependencyType)
+
+// Dependencies between targets of a single config stored in compressed sparse row format. Edges of all targets are
+// kept in one array and each target owns a contiguous range of it, so the graph is just a few allocations. Targets
+// are referred to by their indices in the project. Each pair of targets is connected with at most one edge, which
+// has a bitmask of all dependency types between them. A reverse graph with dependents of each target is stored as well.
+class CmagDependencyGraph {
+public:
+    struct Edge {
+        uint32_t targetIndex = 0;
+        CmagDependencyType types = CmagDependencyType::NONE;
+    };
+
+    struct EdgeRange {
+        const Edge *first = nullptr;
+        const Edge *last = nullptr;
+
+        const Edge *begin() const { return first; }
+        const Edge *end() const { return last; }
+        size_t size() const { return static_cast<size_t>(last - first); }
+        bool empty() const { return first == last; }
+    };
+
+    size_t getTargetsCount() const { return dependencyOffsets.empty() ? 0 : dependencyOffsets.size() - 1; }
+    size_t getEdgesCount() const { return dependencies.size(); }
+    EdgeRange getDependencies(size_t targetIndex) const { return getRange(dependencies, dependencyOffsets, targetIndex); }
+    EdgeRange getDependents(size_t targetIndex) const { return getRange(dependents, dependentOffsets, targetIndex); }
+
+    // Queries following only edges, which have at least one of the given dependency types. Transitive dependents are
+    // all targets, which have to be rebuilt after the given target changes. They are returned in breadth-first order,
+    // so direct dependents come first.
+    bool hasDependents(size_t targetIndex, CmagDependencyType types) const;
+    void collectDependents(size_t targetIndex, CmagDependencyType types, std::vector<uint32_t> &outTargetIndices) const;
+    void collectTransitiveDependents(size_t targetIndex, CmagDependencyType types, std::vector<uint32_t> &outTargetIndices) const;
+
+    // The graph is built by adding dependencies of each target in order of target indices. Passed edges are sorted and
+    // merged in place. After all targets are added, finalize() builds the reverse graph.
+    void clear();
+    void addTarget(std::vector<Edge> &targetDependencies);
+    void finalize();
+
+    // Replaces dependencies of an already added target, so the graph doesn't have to be built again after a few targets
+    // change. Returns dependency types of all edges, which were added, removed or changed. Anything other than NONE
+    // means the graph was modified and finalize() has to be called again.
+    CmagDependencyType replaceTarget(size_t targetIndex, std::vector<Edge> &targetDependencies);
+
+private:
+    static void sortAndMergeEdges(std::vector<Edge> &edges);
+    static EdgeRange getRange(const std::vector<Edge> &edges, const std::vector<uint32_t> &offsets, size_t targetIndex) {
+        const Edge *data = edges.data();
+        return EdgeRange{data + offsets[targetIndex], data + offsets[targetIndex + 1]};
+    }
+
+    std::vector<Edge> dependencies = {};
+    std::vector<uint32_t> dependencyOffsets = {}; // dependencies of target i are in range [offsets[i], offsets[i+1])
+    std::vector<Edge> dependents = {};
+    std::vector<uint32_t> dependentOffsets = {};
+};
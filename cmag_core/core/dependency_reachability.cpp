@@ -0,0 +1,152 @@
+#include "dependency_reachability.h"
+
+#include <algorithm>
+
+#if _MSC_VER
+#include <intrin.h>
+#endif
+
+static size_t countTrailingZeros(uint64_t value) {
+#if _MSC_VER
+    unsigned long index = 0;
+    _BitScanForward64(&index, value);
+    return index;
+#else
+    return static_cast<size_t>(__builtin_ctzll(value));
+#endif
+}
+
+CmagDependencyReachability::CmagDependencyReachability(const CmagDependencyGraph &graph, CmagDependencyType types)
+    : ownedComponents(std::make_unique<CmagDependencyComponents>(graph, types)),
+      components(*ownedComponents) {
+    deriveBitsets();
+}
+
+CmagDependencyReachability::CmagDependencyReachability(const CmagDependencyComponents &components)
+    : components(components) {
+    deriveBitsets();
+}
+
+bool CmagDependencyReachability::dependsOn(size_t srcTargetIndex, size_t dstTargetIndex) const {
+    const uint32_t srcComponent = components.getComponent(srcTargetIndex);
+    const uint32_t dstComponent = components.getComponent(dstTargetIndex);
+    if (hasBitsets()) {
+        const uint64_t word = bitsets[srcComponent * wordsPerBitset + dstComponent / 64];
+        return (word >> (dstComponent % 64)) & 1u;
+    }
+
+    if (srcComponent == dstComponent) {
+        return components.isComponentCyclic(srcComponent);
+    }
+    if (dstComponent > srcComponent) {
+        return false; // edges only point to lower components
+    }
+    return walkDependsOn(srcComponent, dstComponent);
+}
+
+void CmagDependencyReachability::collectDependencies(size_t targetIndex, std::vector<uint32_t> &outTargetIndices) const {
+    outTargetIndices.clear();
+
+    auto addComponentTargets = [&](uint32_t component) {
+        const CmagDependencyComponents::IndexRange targets = components.getComponentTargets(component);
+        outTargetIndices.insert(outTargetIndices.end(), targets.begin(), targets.end());
+    };
+
+    const uint32_t component = components.getComponent(targetIndex);
+    if (hasBitsets()) {
+        const uint64_t *bitset = bitsets.data() + component * wordsPerBitset;
+        for (size_t wordIndex = 0; wordIndex < wordsPerBitset; wordIndex++) {
+            for (uint64_t word = bitset[wordIndex]; word != 0; word &= word - 1) {
+                addComponentTargets(static_cast<uint32_t>(wordIndex * 64 + countTrailingZeros(word)));
+            }
+        }
+    } else {
+        collectReachableComponents(component, walkStack);
+        for (uint32_t reachableComponent : walkStack) {
+            addComponentTargets(reachableComponent);
+        }
+    }
+
+    std::sort(outTargetIndices.begin(), outTargetIndices.end());
+}
+
+void CmagDependencyReachability::deriveBitsets() {
+    const size_t componentsCount = components.getComponentsCount();
+    wordsPerBitset = (componentsCount + 63) / 64;
+    bitsets.clear();
+    if (componentsCount * wordsPerBitset * sizeof(uint64_t) > maxBitsetsBytes) {
+        return;
+    }
+
+    // Edges point to lower components, so bitsets of all dependencies are ready when we get to a component.
+    bitsets.resize(componentsCount * wordsPerBitset, 0);
+    for (uint32_t component = 0; component < componentsCount; component++) {
+        uint64_t *bitset = bitsets.data() + component * wordsPerBitset;
+        for (uint32_t dstComponent : components.getComponentDependencies(component)) {
+            const uint64_t *dstBitset = bitsets.data() + dstComponent * wordsPerBitset;
+            for (size_t wordIndex = 0; wordIndex < wordsPerBitset; wordIndex++) {
+                bitset[wordIndex] |= dstBitset[wordIndex];
+            }
+            bitset[dstComponent / 64] |= uint64_t{1} << (dstComponent % 64);
+        }
+        if (components.isComponentCyclic(component)) {
+            bitset[component / 64] |= uint64_t{1} << (component % 64);
+        }
+    }
+}
+
+bool CmagDependencyReachability::walkDependsOn(uint32_t srcComponent, uint32_t dstComponent) const {
+    // Edges point to lower components, so components lower than the destination cannot reach it and are not visited.
+    const uint32_t stamp = startWalk();
+    walkStack.clear();
+    walkStack.push_back(srcComponent);
+    visitStamps[srcComponent] = stamp;
+    while (!walkStack.empty()) {
+        const uint32_t currentComponent = walkStack.back();
+        walkStack.pop_back();
+        for (uint32_t nextComponent : components.getComponentDependencies(currentComponent)) {
+            if (nextComponent == dstComponent) {
+                return true;
+            }
+            if (nextComponent > dstComponent && visitStamps[nextComponent] != stamp) {
+                visitStamps[nextComponent] = stamp;
+                walkStack.push_back(nextComponent);
+            }
+        }
+    }
+    return false;
+}
+
+void CmagDependencyReachability::collectReachableComponents(uint32_t component, std::vector<uint32_t> &outComponents) const {
+    outComponents.clear();
+    if (components.isComponentCyclic(component)) {
+        outComponents.push_back(component);
+    }
+
+    // The output vector doubles as a stack of components to visit. Starting component is not pushed to it unless it's
+    // cyclic, so it's iterated separately.
+    const uint32_t stamp = startWalk();
+    visitStamps[component] = stamp;
+    auto visitEdges = [&](uint32_t currentComponent) {
+        for (uint32_t dstComponent : components.getComponentDependencies(currentComponent)) {
+            if (visitStamps[dstComponent] != stamp) {
+                visitStamps[dstComponent] = stamp;
+                outComponents.push_back(dstComponent);
+            }
+        }
+    };
+    visitEdges(component);
+    for (size_t componentIndex = 0; componentIndex < outComponents.size(); componentIndex++) {
+        if (outComponents[componentIndex] != component) {
+            visitEdges(outComponents[componentIndex]);
+        }
+    }
+}
+
+uint32_t CmagDependencyReachability::startWalk() const {
+    if (visitStamps.empty() || walkStamp == UINT32_MAX) {
+        visitStamps.assign(components.getComponentsCount(), 0);
+        walkStamp = 0;
+    }
+    return ++walkStamp;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "cmag_core/core/dependency_components.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Answers questions like "does A transitively depend on B" or "what does X pull in" for one dependency graph, following
+// only edges with given dependency types. Queries work on the condensed graph of strongly connected components. Each
+// component gets a bitset of components reachable from it, which makes queries O(1). For huge graphs the bitsets would
+// not fit in memory, so in that case queries walk the condensed graph instead. Walks reuse scratch memory of the object,
+// so queries are not thread-safe.
+class CmagDependencyReachability {
+public:
+    CmagDependencyReachability(const CmagDependencyGraph &graph, CmagDependencyType types);
+    explicit CmagDependencyReachability(const CmagDependencyComponents &components); // components must outlive this object
+
+    // A target depends on itself only if it's a part of a cycle.
+    bool dependsOn(size_t srcTargetIndex, size_t dstTargetIndex) const;
+    void collectDependencies(size_t targetIndex, std::vector<uint32_t> &outTargetIndices) const; // sorted by target index
+
+    CmagDependencyType getTypes() const { return components.getTypes(); }
+    const CmagDependencyComponents &getComponents() const { return components; }
+    bool hasBitsets() const { return !bitsets.empty(); }
+
+    constexpr static size_t maxBitsetsBytes = 64 * 1024 * 1024;
+
+private:
+    void deriveBitsets();
+    bool walkDependsOn(uint32_t srcComponent, uint32_t dstComponent) const;
+    void collectReachableComponents(uint32_t component, std::vector<uint32_t> &outComponents) const;
+    uint32_t startWalk() const;
+
+    std::unique_ptr<CmagDependencyComponents> ownedComponents = {};
+    const CmagDependencyComponents &components;
+
+    // Bit d of the bitset of component c is set, if c can reach d with a non-empty path.
+    size_t wordsPerBitset = 0;
+    std::vector<uint64_t> bitsets = {};
+
+    // Scratch memory for walks. Component c is visited in the current walk, if its stamp equals current walk stamp.
+    mutable std::vector<uint32_t> visitStamps = {};
+    mutable uint32_t walkStamp = 0;
+    mutable std::vector<uint32_t> walkStack = {};
+};
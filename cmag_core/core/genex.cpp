@@ -0,0 +1,166 @@
+#include "genex.h"
+
+#include <cstring>
+
+class CmagGenexTree::Parser {
+public:
+    explicit Parser(CmagGenexTree &tree) : tree(tree), value(tree.value) {}
+
+    void parse() {
+        const SequenceEnd end = parseSequence(SequenceContext::TopLevel, tree.root);
+        tree.valid = tree.valid && end == SequenceEnd::EndOfValue;
+    }
+
+private:
+    enum class SequenceContext {
+        TopLevel,
+        GenexName,
+        GenexParameter,
+    };
+
+    enum class SequenceEnd {
+        EndOfValue,
+        Colon,
+        Comma,
+        GenexEnd,
+    };
+
+    SequenceEnd parseSequence(SequenceContext context, CmagGenexSequence &outSequence) {
+        const size_t nodeStackStart = nodeStack.size();
+        size_t textStart = position;
+        SequenceEnd end = SequenceEnd::EndOfValue;
+        while (position < value.size()) {
+            const char currentChar = value[position];
+            if (currentChar == '$' && position + 1 < value.size() && value[position + 1] == '<') {
+                pushText(textStart);
+                parseGenex();
+                if (!tree.valid) {
+                    return SequenceEnd::EndOfValue;
+                }
+                textStart = position;
+                continue;
+            }
+
+            if (context == SequenceContext::TopLevel) {
+                // Escaped semicolons are not list separators
+                if (currentChar == ';' && (position == 0 || value[position - 1] != '\\')) {
+                    pushText(textStart);
+                    nodeStack.push_back(CmagGenexNode{CmagGenexNodeType::ListSeparator, static_cast<uint32_t>(position), 1u});
+                    textStart = ++position;
+                    continue;
+                }
+            } else {
+                if (currentChar == '>') {
+                    end = SequenceEnd::GenexEnd;
+                    break;
+                }
+                if (currentChar == ':' && context == SequenceContext::GenexName) {
+                    end = SequenceEnd::Colon;
+                    break;
+                }
+                if (currentChar == ',' && context == SequenceContext::GenexParameter) {
+                    end = SequenceEnd::Comma;
+                    break;
+                }
+            }
+
+            position++;
+        }
+        pushText(textStart);
+
+        outSequence.nodesCount = static_cast<uint32_t>(nodeStack.size() - nodeStackStart);
+        outSequence.nodesBegin = moveStackTop(nodeStack, nodeStackStart, tree.nodes);
+        if (end != SequenceEnd::EndOfValue) {
+            position++; // skip the delimiter
+        }
+        return end;
+    }
+
+    void parseGenex() {
+        const size_t genexStart = position;
+        position += 2; // skip "$<"
+
+        // Parse name and parameters. First colon ends the name, next ones are a part of parameters.
+        const size_t sequenceStackStart = sequenceStack.size();
+        CmagGenexSequence sequence = {};
+        SequenceEnd end = parseSequence(SequenceContext::GenexName, sequence);
+        sequenceStack.push_back(sequence);
+        while (end == SequenceEnd::Colon || end == SequenceEnd::Comma) {
+            end = parseSequence(SequenceContext::GenexParameter, sequence);
+            sequenceStack.push_back(sequence);
+        }
+        if (end != SequenceEnd::GenexEnd) {
+            // Unclosed genex
+            tree.valid = false;
+            return;
+        }
+
+        CmagGenexNode node = {};
+        node.type = CmagGenexNodeType::Genex;
+        node.offset = static_cast<uint32_t>(genexStart);
+        node.length = static_cast<uint32_t>(position - genexStart);
+        node.sequencesCount = static_cast<uint32_t>(sequenceStack.size() - sequenceStackStart);
+        node.sequencesBegin = moveStackTop(sequenceStack, sequenceStackStart, tree.sequences);
+        nodeStack.push_back(node);
+    }
+
+    void pushText(size_t textStart) {
+        if (position > textStart) {
+            nodeStack.push_back(CmagGenexNode{CmagGenexNodeType::Text, static_cast<uint32_t>(textStart), static_cast<uint32_t>(position - textStart)});
+        }
+    }
+
+    template <typename T, typename OutputT>
+    static uint32_t moveStackTop(std::vector<T> &stack, size_t stackStart, OutputT &output) {
+        const auto outputStart = static_cast<uint32_t>(output.size());
+        output.insert(output.end(), stack.begin() + static_cast<ptrdiff_t>(stackStart), stack.end());
+        stack.resize(stackStart);
+        return outputStart;
+    }
+
+    CmagGenexTree &tree;
+    const std::string_view value;
+    size_t position = 0;
+
+    // Nodes and sequences are pushed on these stacks while parsing and moved to the tree once the sequence or the
+    // genex owning them is complete. This way children of every node are stored contiguously.
+    std::vector<CmagGenexNode> nodeStack = {};
+    std::vector<CmagGenexSequence> sequenceStack = {};
+};
+
+CmagGenexTree::CmagGenexTree(std::string_view value, std::pmr::memory_resource *memoryResource)
+    : value(value),
+      nodes(memoryResource),
+      sequences(memoryResource) {
+    Parser{*this}.parse();
+}
+
+std::string_view CmagGenexTree::getGenexName(const CmagGenexNode &node) const {
+    const CmagGenexSequence &name = sequences[node.sequencesBegin];
+    if (name.nodesCount != 1) {
+        return {};
+    }
+    const CmagGenexNode &nameNode = getNode(name, 0);
+    if (nameNode.type != CmagGenexNodeType::Text) {
+        return {};
+    }
+    return getText(nameNode);
+}
+
+CmagGenexCache::CmagGenexCache(std::pmr::memory_resource *upstreamMemoryResource)
+    : memoryResource(upstreamMemoryResource) {}
+
+const CmagGenexTree &CmagGenexCache::parse(std::string_view value) {
+    if (auto it = trees.find(value); it != trees.end()) {
+        return it->second;
+    }
+
+    // Copy the value to the arena, so the tree and the key can reference it
+    std::string_view storedValue = {};
+    if (!value.empty()) {
+        char *storage = static_cast<char *>(memoryResource.allocate(value.size(), alignof(char)));
+        std::memcpy(storage, value.data(), value.size());
+        storedValue = std::string_view{storage, value.size()};
+    }
+    return trees.try_emplace(storedValue, storedValue, &memoryResource).first->second;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Generator expressions are parsed into a flat tree. A value is a sequence of nodes. Text nodes are slices of the
+// parsed value, list separators are semicolons outside of any genex and genex nodes own a range of sequences: first
+// one is the name (it can contain nested genexes, e.g. $<$<CONFIG:Debug>:X>) and the rest are parameters separated
+// by commas. Escape genexes, like $<ANGLE-R> or $<SEMICOLON>, are regular genex nodes with no parameters.
+enum class CmagGenexNodeType : uint8_t {
+    Text,
+    ListSeparator,
+    Genex,
+};
+
+struct CmagGenexSequence {
+    uint32_t nodesBegin = 0;
+    uint32_t nodesCount = 0;
+};
+
+struct CmagGenexNode {
+    CmagGenexNodeType type = CmagGenexNodeType::Text;
+    uint32_t offset = 0;         // position in the parsed value, for genexes it points at "$<"
+    uint32_t length = 0;         // length in the parsed value, for genexes it includes "$<" and ">"
+    uint32_t sequencesBegin = 0; // genex only
+    uint32_t sequencesCount = 0; // genex only, name and parameters
+};
+
+class CmagGenexTree {
+public:
+    CmagGenexTree(std::string_view value, std::pmr::memory_resource *memoryResource);
+
+    bool isValid() const { return valid; }
+    std::string_view getValue() const { return value; }
+    const CmagGenexSequence &getRoot() const { return root; }
+    const CmagGenexNode &getNode(const CmagGenexSequence &sequence, size_t index) const { return nodes[sequence.nodesBegin + index]; }
+    std::string_view getText(const CmagGenexNode &node) const { return value.substr(node.offset, node.length); }
+
+    // Genex accessors. Name is returned only if it's a plain text, otherwise it's empty.
+    std::string_view getGenexName(const CmagGenexNode &node) const;
+    size_t getGenexParametersCount(const CmagGenexNode &node) const { return node.sequencesCount - 1; }
+    const CmagGenexSequence &getGenexParameter(const CmagGenexNode &node, size_t index) const { return sequences[node.sequencesBegin + 1 + index]; }
+
+private:
+    class Parser;
+
+    std::string_view value;
+    bool valid = true;
+    CmagGenexSequence root = {};
+    std::pmr::vector<CmagGenexNode> nodes;
+    std::pmr::vector<CmagGenexSequence> sequences;
+};
+
+// Property values repeat a lot, e.g. the same LINK_LIBRARIES in every config. The cache parses each distinct value
+// only once. Values and trees are allocated from a monotonic arena, which is released with the cache.
+class CmagGenexCache {
+public:
+    explicit CmagGenexCache(std::pmr::memory_resource *upstreamMemoryResource = std::pmr::get_default_resource());
+    CmagGenexCache(const CmagGenexCache &) = delete;
+    CmagGenexCache &operator=(const CmagGenexCache &) = delete;
+
+    const CmagGenexTree &parse(std::string_view value);
+    size_t size() const { return trees.size(); }
+
+private:
+    std::pmr::monotonic_buffer_resource memoryResource;
+    std::unordered_map<std::string_view, CmagGenexTree> trees = {}; // keys are views into the arena
+};
@@ -0,0 +1,50 @@
+#include "property_name_table.h"
+
+#include "cmag_core/utils/error.h"
+
+CmagPropertyNameTable::CmagPropertyNameTable() {
+    const char *wellKnownNames[] = {
+        "LINK_LIBRARIES",
+        "INTERFACE_LINK_LIBRARIES",
+        "MANUALLY_ADDED_DEPENDENCIES",
+        "FOLDER",
+    };
+    static_assert(sizeof(wellKnownNames) / sizeof(wellKnownNames[0]) == static_cast<size_t>(CmagPropertyId::COUNT_WELL_KNOWN));
+
+    for (size_t i = 0; i < static_cast<size_t>(CmagPropertyId::COUNT_WELL_KNOWN); i++) {
+        const CmagPropertyId id = intern(wellKnownNames[i]);
+        FATAL_ERROR_IF(id != static_cast<CmagPropertyId>(i), "Invalid id of a well-known property");
+    }
+}
+
+CmagPropertyNameTable::CmagPropertyNameTable(const CmagPropertyNameTable &other) {
+    *this = other;
+}
+
+CmagPropertyNameTable &CmagPropertyNameTable::operator=(const CmagPropertyNameTable &other) {
+    // Keys of the map are views into the names storage, so they cannot be simply copied.
+    names = other.names;
+    ids.clear();
+    for (size_t i = 0; i < names.size(); i++) {
+        ids.emplace(names[i], static_cast<CmagPropertyId>(i));
+    }
+    return *this;
+}
+
+CmagPropertyId CmagPropertyNameTable::intern(std::string_view name) {
+    if (auto it = ids.find(name); it != ids.end()) {
+        return it->second;
+    }
+
+    const auto id = static_cast<CmagPropertyId>(names.size());
+    const std::string &storedName = names.emplace_back(name);
+    ids.emplace(storedName, id);
+    return id;
+}
+
+CmagPropertyId CmagPropertyNameTable::find(std::string_view name) const {
+    if (auto it = ids.find(name); it != ids.end()) {
+        return it->second;
+    }
+    return CmagPropertyId::Invalid;
+}
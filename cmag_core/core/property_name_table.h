@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+enum class CmagPropertyId : uint32_t {
+    // Properties needed for data derivation. They are always registered first, so their ids are constant.
+    LinkLibraries,
+    InterfaceLinkLibraries,
+    ManuallyAddedDependencies,
+    Folder,
+
+    COUNT_WELL_KNOWN,
+    Invalid = UINT32_MAX,
+};
+
+class CmagPropertyNameTable {
+public:
+    CmagPropertyNameTable();
+    CmagPropertyNameTable(const CmagPropertyNameTable &other);
+    CmagPropertyNameTable &operator=(const CmagPropertyNameTable &other);
+    CmagPropertyNameTable(CmagPropertyNameTable &&other) = default;
+    CmagPropertyNameTable &operator=(CmagPropertyNameTable &&other) = default;
+
+    CmagPropertyId intern(std::string_view name);
+    CmagPropertyId find(std::string_view name) const;
+    std::string_view getName(CmagPropertyId id) const { return names[static_cast<size_t>(id)]; }
+    size_t size() const { return names.size(); }
+
+private:
+    // Names are stored in a deque, so they never move and can be referenced by the views used as keys.
+    std::deque<std::string> names = {};
+    std::unordered_map<std::string_view, CmagPropertyId> ids = {};
+};
@@ -0,0 +1,45 @@
+#include "property_value_table.h"
+
+#include "cmag_core/utils/string_utils.h"
+
+CmagPropertyValueTable::CmagPropertyValueTable(std::pmr::memory_resource *memoryResource)
+    : memoryResource(memoryResource) {
+    insert("");
+}
+
+CmagPropertyValueId CmagPropertyValueTable::intern(std::string_view value) {
+    if (auto it = ids.find(value); it != ids.end()) {
+        return it->second;
+    }
+    return insert(storeString(value, memoryResource));
+}
+
+CmagPropertyValueId CmagPropertyValueTable::internExternal(std::string_view value) {
+    if (auto it = ids.find(value); it != ids.end()) {
+        return it->second;
+    }
+    return insert(value);
+}
+
+CmagPropertyValueId CmagPropertyValueTable::find(std::string_view value) const {
+    if (auto it = ids.find(value); it != ids.end()) {
+        return it->second;
+    }
+    return CmagPropertyValueId::Invalid;
+}
+
+bool CmagPropertyValueTable::isStoredValue(std::string_view value, CmagPropertyValueId id) const {
+    // Comparing pointers is enough, so properties which are already interned can be recognized in constant time.
+    if (static_cast<size_t>(id) >= values.size()) {
+        return false;
+    }
+    const std::string_view storedValue = values[static_cast<size_t>(id)];
+    return value.size() == storedValue.size() && (value.empty() || value.data() == storedValue.data());
+}
+
+CmagPropertyValueId CmagPropertyValueTable::insert(std::string_view storedValue) {
+    const auto id = static_cast<CmagPropertyValueId>(values.size());
+    values.push_back(storedValue);
+    ids.emplace(storedValue, id);
+    return id;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+enum class CmagPropertyValueId : uint32_t {
+    Empty, // empty string is always registered first
+    Invalid = UINT32_MAX,
+};
+
+// Deduplicated values of properties. Configs of a target usually share most of their values and a lot of values
+// repeat between targets too, so each distinct value is stored only once and properties reference it with an id.
+// Comparing values becomes comparing ids. Values are copied to the memory resource given at construction, which is
+// expected to be monotonic. Nothing is ever removed, so values no longer used by any property stay until the table is
+// destroyed.
+class CmagPropertyValueTable {
+public:
+    explicit CmagPropertyValueTable(std::pmr::memory_resource *memoryResource);
+    CmagPropertyValueTable(const CmagPropertyValueTable &other) = delete;
+    CmagPropertyValueTable &operator=(const CmagPropertyValueTable &other) = delete;
+    CmagPropertyValueTable(CmagPropertyValueTable &&other) = default;
+    CmagPropertyValueTable &operator=(CmagPropertyValueTable &&other) = default;
+
+    CmagPropertyValueId intern(std::string_view value);         // copies the value, if it's not in the table yet
+    CmagPropertyValueId internExternal(std::string_view value); // doesn't copy the value, it has to outlive the table
+    CmagPropertyValueId find(std::string_view value) const;
+    std::string_view getValue(CmagPropertyValueId id) const { return values[static_cast<size_t>(id)]; }
+    bool isStoredValue(std::string_view value, CmagPropertyValueId id) const; // whether the view points to the stored value with given id
+    size_t size() const { return values.size(); }
+
+private:
+    CmagPropertyValueId insert(std::string_view storedValue);
+
+    std::pmr::memory_resource *memoryResource;
+    std::vector<std::string_view> values = {};
+    std::unordered_map<std::string_view, CmagPropertyValueId> ids = {};
+};
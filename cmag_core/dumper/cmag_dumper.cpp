@@ -2,13 +2,16 @@
 
 #include "cmag_core/core/version.h"
 #include "cmag_core/parse/cmag_json_parser.h"
-#include "cmag_core/parse/cmag_json_writer.h"
 #include "cmag_core/shim/cmake_lists_shimmer.h"
 #include "cmag_core/utils/error.h"
 #include "cmag_core/utils/file_utils.h"
 #include "cmag_core/utils/string_utils.h"
 #include "cmag_core/utils/subprocess.h"
+#include "cmag_core/utils/thread_pool.h"
 
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
 #include <string_view>
 
 #define RETURN_ERROR(expr)                \
@@ -82,16 +85,16 @@ CmagResult CmagDumper::cmakeMainPass() {
 CmagResult CmagDumper::readCmagProjectName() {
     const char *fileName = ".cmag-project-name";
     const fs::path file = addTemporaryFile(fileName);
-    const auto fileContent = readFile(file);
-    if (!fileContent.has_value()) {
+    FileView fileView = {};
+    if (!fileView.open(file)) {
         LOG_ERROR("failed to read ", fileName);
         return CmagResult::FileAccessError;
     }
-    if (fileContent.value().empty()) {
+    if (fileView.getContent().empty()) {
         LOG_ERROR("file ", fileName, " is empty");
         return CmagResult::ProjectCreationError;
     }
-    this->projectName = fileContent.value();
+    this->projectName = fileView.getContent();
     return CmagResult::Success;
 }
 
@@ -101,13 +104,13 @@ CmagResult CmagDumper::readCmakeAfterMainPass() {
     {
         const std::string fileName = projectName + ".cmag-targets-list";
         const fs::path file = addTemporaryFile(fileName);
-        const auto fileContent = readFile(file);
-        if (!fileContent.has_value()) {
+        FileView fileView = {};
+        if (!fileView.open(file)) {
             LOG_ERROR("failed to read ", fileName);
             return CmagResult::FileAccessError;
         }
         std::vector<std::string> targetFilesNames = {};
-        const ParseResult parseResult = CmagJsonParser::parseTargetsFilesListFile(fileContent.value(), targetFilesNames);
+        const ParseResult parseResult = CmagJsonParser::parseTargetsFilesListFile(fileView.getContent(), targetFilesNames);
         if (parseResult.status != ParseResultStatus::Success) {
             LOG_ERROR("failed to parse ", fileName, ". ", parseResult.errorMessage);
             return CmagResult::JsonParseError;
@@ -122,30 +125,54 @@ CmagResult CmagDumper::readCmakeAfterMainPass() {
     {
         const std::string fileName = std::string(projectName) + ".cmag-globals";
         const fs::path file = addTemporaryFile(fileName);
-        const auto fileContent = readFile(file);
-        if (!fileContent.has_value()) {
+        FileView fileView = {};
+        if (!fileView.open(file)) {
             LOG_ERROR("failed to read ", fileName);
             return CmagResult::FileAccessError;
         }
-        const ParseResult parseResult = CmagJsonParser::parseGlobalsFile(fileContent.value(), globals);
+        const ParseResult parseResult = CmagJsonParser::parseGlobalsFile(fileView.getContent(), globals);
         if (parseResult.status != ParseResultStatus::Success) {
             LOG_ERROR("failed to parse ", fileName, ". ", parseResult.errorMessage);
             return CmagResult::JsonParseError;
         }
     }
 
-    // Read targets
-    std::vector<CmagTarget> targets = {};
+    // Read targets. Each list dir has its own targets file, so they are parsed concurrently. Each file is then parsed
+    // on a single thread, unless there's only one. Errors are reported and targets are added to the project in order
+    // of the files, so the result doesn't depend on scheduling. Strings of the targets have to be kept until the
+    // targets are added to the project.
+    std::vector<std::vector<CmagTarget>> targetsPerFile(targetsFiles.size());
+    std::vector<std::unique_ptr<std::pmr::monotonic_buffer_resource>> memoryResourcesPerFile(targetsFiles.size());
+    for (auto &memoryResource : memoryResourcesPerFile) {
+        memoryResource = std::make_unique<std::pmr::monotonic_buffer_resource>();
+    }
     {
-        for (const fs::path &file : targetsFiles) {
-            const auto fileContent = readFile(file);
-            if (!fileContent.has_value()) {
-                LOG_ERROR("failed to read ", file.filename().string());
+        std::vector<uint8_t> filesRead(targetsFiles.size(), 0);
+        std::vector<ParseResult> parseResults(targetsFiles.size(), ParseResult::success);
+        const bool multithreadedFiles = targetsFiles.size() > 1;
+        auto parseTargetsFile = [&](size_t fileIndex) {
+            FileView fileView = {};
+            if (fileView.open(targetsFiles[fileIndex])) {
+                filesRead[fileIndex] = 1;
+                parseResults[fileIndex] = CmagJsonParser::parseTargetsFile(fileView.getContent(), targetsPerFile[fileIndex], memoryResourcesPerFile[fileIndex].get(), !multithreadedFiles);
+            }
+        };
+        if (multithreadedFiles) {
+            const size_t threadsCount = std::min(targetsFiles.size(), ThreadPool::getDefaultThreadsCount());
+            ThreadPool threadPool{threadsCount};
+            threadPool.parallelFor(targetsFiles.size(), parseTargetsFile);
+        } else if (!targetsFiles.empty()) {
+            parseTargetsFile(0);
+        }
+
+        for (size_t fileIndex = 0; fileIndex < targetsFiles.size(); fileIndex++) {
+            const std::string fileName = targetsFiles[fileIndex].filename().string();
+            if (!filesRead[fileIndex]) {
+                LOG_ERROR("failed to read ", fileName);
                 return CmagResult::FileAccessError;
             }
-            const ParseResult parseResult = CmagJsonParser::parseTargetsFile(fileContent.value(), targets);
-            if (parseResult.status != ParseResultStatus::Success) {
-                LOG_ERROR("failed to parse ", file.filename().string(), ". ", parseResult.errorMessage);
+            if (parseResults[fileIndex].status != ParseResultStatus::Success) {
+                LOG_ERROR("failed to parse ", fileName, ". ", parseResults[fileIndex].errorMessage);
                 return CmagResult::JsonParseError;
             }
         }
@@ -153,11 +180,13 @@ CmagResult CmagDumper::readCmakeAfterMainPass() {
 
     // Assign values to project
     project.getGlobals() = std::move(globals);
-    for (CmagTarget &target : targets) {
-        bool addResult = project.addTarget(std::move(target));
-        if (!addResult) {
-            LOG_ERROR("failed to create project");
-            return CmagResult::ProjectCreationError;
+    for (std::vector<CmagTarget> &targets : targetsPerFile) {
+        for (CmagTarget &target : targets) {
+            bool addResult = project.addTarget(std::move(target));
+            if (!addResult) {
+                LOG_ERROR("failed to create project");
+                return CmagResult::ProjectCreationError;
+            }
         }
     }
 
@@ -166,7 +195,7 @@ CmagResult CmagDumper::readCmakeAfterMainPass() {
 
 CmagResult CmagDumper::cmakeSecondPass() {
     // Derive extra data
-    if (!project.deriveData()) {
+    if (!project.deriveData(true)) {
         LOG_ERROR("failed to derive extra data\n");
         return CmagResult::DerivationError;
     }
@@ -185,13 +214,13 @@ CmagResult CmagDumper::readCmakeAfterSecondPass() {
     {
         const std::string fileName = projectName + ".cmag-aliases";
         const fs::path file = addTemporaryFile(fileName);
-        const auto fileContent = readFile(file);
-        if (!fileContent.has_value()) {
+        FileView fileView = {};
+        if (!fileView.open(file)) {
             LOG_ERROR("failed to read ", fileName);
             return CmagResult::FileAccessError;
         }
         temporaryFiles.push_back(file);
-        const ParseResult parseResult = CmagJsonParser::parseAliasesFile(fileContent.value(), aliases);
+        const ParseResult parseResult = CmagJsonParser::parseAliasesFile(fileView.getContent(), aliases);
         if (parseResult.status != ParseResultStatus::Success) {
             LOG_ERROR("failed to parse ", fileName, ". ", parseResult.errorMessage);
             return CmagResult::JsonParseError;
@@ -208,20 +237,21 @@ CmagResult CmagDumper::readCmakeAfterSecondPass() {
     return CmagResult::Success;
 }
 
-CmagResult CmagDumper::writeProjectToFile() {
-    std::string fileName = std::string(projectName) + ".cmag-project";
+CmagResult CmagDumper::writeProjectToFile(CmagProjectFormat format) {
+    std::string fileName = std::string(projectName) + CmagProjectFile::getExtension(format);
     fs::path filePath = buildPath / fileName;
-    std::ofstream outFile{filePath, std::ios::out};
+    std::ofstream outFile{filePath, CmagProjectFile::getOpenMode(format)};
     if (!outFile) {
         LOG_ERROR("failed to open ", fileName);
         return CmagResult::FileAccessError;
     }
-    CmagJsonWriter::writeProject(project, outFile);
+    CmagProjectFile::writeProject(project, outFile, format);
     if (!outFile) {
         LOG_ERROR("failed to write to ", fileName);
         return CmagResult::FileAccessError;
     }
 
+    projectFilePath = filePath;
     LOG_INFO("Successfully written project file to ", filePath.string());
     return CmagResult::Success;
 }
@@ -239,8 +269,11 @@ CmagResult CmagDumper::cleanupTemporaryFiles() {
 CmagResult CmagDumper::launchProjectInGui() {
     const fs::path browserBinaryPath = getExeLocation().parent_path() / CMAG_BROWSER_BINARY_NAME;
 
-    std::string fileName = std::string(projectName) + ".cmag-project";
-    fs::path projectPath = buildPath / fileName;
+    fs::path projectPath = projectFilePath;
+    if (projectPath.empty()) {
+        std::string fileName = std::string(projectName) + CmagProjectFile::getExtension(CmagProjectFormat::Json);
+        projectPath = buildPath / fileName;
+    }
 
     std::vector<std::string> browserArgs = {};
     browserArgs.push_back(browserBinaryPath.string());
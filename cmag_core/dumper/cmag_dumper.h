@@ -1,6 +1,7 @@
 #pragma once
 
 #include "cmag_core/core/cmag_project.h"
+#include "cmag_core/parse/cmag_project_file.h"
 #include "cmag_core/utils/filesystem.h"
 
 #include <string_view>
@@ -26,7 +27,7 @@ public:
     ~CmagDumper();
 
     CmagResult dump();
-    CmagResult writeProjectToFile();
+    CmagResult writeProjectToFile(CmagProjectFormat format = CmagProjectFormat::Json);
     CmagResult cleanupTemporaryFiles();
     CmagResult launchProjectInGui();
 
@@ -50,5 +51,6 @@ protected:
     const std::string extraTargetProperties;
 
     CmagProject project = {};
+    fs::path projectFilePath = {};
     std::vector<fs::path> temporaryFiles = {};
 };
@@ -44,6 +44,10 @@ DumperArgumentParser::DumperArgumentParser(int argc, const char **argv) : argc(a
             extraTargetProperties += value;
             validArg = true;
         }
+        if (const char *value = parseKeyValueArgument("-c", argIndex, arg, nextArg); value) {
+            convertPath = value;
+            validArg = true;
+        }
         if (arg == "-v") {
             showVersion = true;
             validArg = true;
@@ -60,6 +64,10 @@ DumperArgumentParser::DumperArgumentParser(int argc, const char **argv) : argc(a
             makeFindPackageGlobal = true;
             validArg = true;
         }
+        if (arg == "-b") {
+            binaryProject = true;
+            validArg = true;
+        }
 
         // Check validity of current arg
         if (!validArg) {
@@ -106,8 +114,8 @@ DumperArgumentParser::DumperArgumentParser(int argc, const char **argv) : argc(a
         sourcePath = arg;
     }
 
-    // Handle arguments that were not passed by user
-    if (sourcePath.empty() && buildPath.empty()) {
+    // Handle arguments that were not passed by user. Converting a project file does not require CMake command.
+    if (sourcePath.empty() && buildPath.empty() && convertPath.empty()) {
         valid = false;
     }
     if (sourcePath.empty()) {
@@ -16,6 +16,8 @@ public:
     auto getLaunchGui() const { return launchGui; }
     auto getShowVersion() const { return showVersion; }
     auto getMakeFindPackageGlobal() const { return makeFindPackageGlobal; }
+    auto getBinaryProject() const { return binaryProject; }
+    const auto &getConvertPath() const { return convertPath; }
 
     const auto &getSourcePath() const { return sourcePath; }
     const auto &getBuildPath() const { return buildPath; }
@@ -40,6 +42,8 @@ private:
     bool jsonDebug = false;
     bool launchGui = false;
     bool makeFindPackageGlobal = false;
+    bool binaryProject = false;
+    fs::path convertPath = {};
 
     // Cmake args
     fs::path sourcePath = {};
@@ -0,0 +1,151 @@
+#include "cmag_binary_format.h"
+
+#include "cmag_core/core/cmag_project.h"
+#include "cmag_core/utils/error.h"
+
+#include <cstring>
+
+#define RETURN_ERROR(expr)                              \
+    do {                                                \
+        const ParseResult r = (expr);                   \
+        if ((r.status) != ParseResultStatus::Success) { \
+            return (r);                                 \
+        }                                               \
+    } while (false)
+
+bool CmagBinaryProjectView::hasMagic(std::string_view data) {
+    return data.size() >= sizeof(cmagBinaryMagic) && memcmp(data.data(), cmagBinaryMagic, sizeof(cmagBinaryMagic)) == 0;
+}
+
+ParseResult CmagBinaryProjectView::open(std::string_view data) {
+    *this = {};
+
+    if (!hasMagic(data)) {
+        return {ParseResultStatus::Malformed, "Invalid binary project file header"};
+    }
+    if (data.size() < sizeof(CmagBinaryHeader)) {
+        return {ParseResultStatus::Malformed, "Binary project file is truncated"};
+    }
+    if (reinterpret_cast<uintptr_t>(data.data()) % alignof(CmagBinaryHeader) != 0) {
+        return {ParseResultStatus::Malformed, "Binary project data is misaligned"};
+    }
+
+    const auto *newHeader = reinterpret_cast<const CmagBinaryHeader *>(data.data());
+    if (newHeader->endiannessMarker != cmagBinaryEndiannessMarker) {
+        return {ParseResultStatus::Malformed, "Binary project file has invalid endianness"};
+    }
+    if (newHeader->formatVersion != cmagBinaryFormatVersion) {
+        return {
+            ParseResultStatus::VersionMismatch,
+            LOG_TO_STRING("Incompatible binary project format. Current format is ", cmagBinaryFormatVersion, " and project file format is ", newHeader->formatVersion, ".")};
+    }
+    header = newHeader;
+
+    const char *stringsData = nullptr;
+    RETURN_ERROR(openSection(data, header->strings, "strings", stringsData));
+    strings = std::string_view{stringsData, header->strings.count};
+
+    if (header->globals.count != 1) {
+        return {ParseResultStatus::Malformed, "Binary project file must contain exactly one globals record"};
+    }
+    RETURN_ERROR(openSection(data, header->globals, "globals", globals));
+    RETURN_ERROR(openSection(data, header->listDirs, "listDirs", listDirs));
+    RETURN_ERROR(openSection(data, header->listDirChildren, "listDirChildren", listDirChildren));
+    RETURN_ERROR(openSection(data, header->targets, "targets", targets));
+    RETURN_ERROR(openSection(data, header->configs, "configs", configs));
+    RETURN_ERROR(openSection(data, header->properties, "properties", properties));
+    RETURN_ERROR(openSection(data, header->aliases, "aliases", aliases));
+
+    return validateRecords();
+}
+
+template <typename T>
+ParseResult CmagBinaryProjectView::openSection(std::string_view data, const CmagBinarySection &section, const char *name, const T *&outRecords) {
+    const uint64_t sectionEnd = uint64_t{section.offset} + uint64_t{section.count} * sizeof(T);
+    if (sectionEnd > data.size()) {
+        return {ParseResultStatus::Malformed, LOG_TO_STRING("Section ", name, " exceeds binary project file size")};
+    }
+    if (section.offset % alignof(T) != 0) {
+        return {ParseResultStatus::Malformed, LOG_TO_STRING("Section ", name, " is misaligned")};
+    }
+    outRecords = reinterpret_cast<const T *>(data.data() + section.offset);
+    return ParseResult::success;
+}
+
+bool CmagBinaryProjectView::isValidString(CmagBinaryString string) const {
+    return uint64_t{string.offset} + string.length <= strings.size();
+}
+
+bool CmagBinaryProjectView::isValidRange(CmagBinaryRange range, const CmagBinarySection &section) {
+    return uint64_t{range.first} + range.count <= section.count;
+}
+
+ParseResult CmagBinaryProjectView::validateRecords() const {
+    const ParseResult invalidString{ParseResultStatus::InvalidValue, "Invalid string reference in binary project file"};
+    const ParseResult invalidRange{ParseResultStatus::InvalidValue, "Invalid record range in binary project file"};
+
+    const CmagBinaryGlobals &globalsRecord = *globals;
+    for (CmagBinaryString string : {globalsRecord.cmagVersion, globalsRecord.selectedConfig, globalsRecord.cmakeVersion,
+                                    globalsRecord.cmakeProjectName, globalsRecord.cmagProjectName, globalsRecord.sourceDir,
+                                    globalsRecord.buildDir, globalsRecord.generator, globalsRecord.compilerId,
+                                    globalsRecord.compilerVersion, globalsRecord.os, globalsRecord.useFolders,
+                                    globalsRecord.selectedTargetName}) {
+        if (!isValidString(string)) {
+            return invalidString;
+        }
+    }
+    const auto allDependencyTypes = static_cast<uint32_t>(CmagDependencyType::Build | CmagDependencyType::Interface | CmagDependencyType::Additional);
+    if ((globalsRecord.displayedDependencyType & ~allDependencyTypes) != 0) {
+        return {ParseResultStatus::InvalidValue, "Invalid displayed dependency type in binary project file"};
+    }
+
+    for (uint32_t i = 0; i < header->listDirs.count; i++) {
+        if (!isValidString(listDirs[i].name)) {
+            return invalidString;
+        }
+        if (!isValidRange(listDirs[i].children, header->listDirChildren)) {
+            return invalidRange;
+        }
+    }
+    for (uint32_t i = 0; i < header->listDirChildren.count; i++) {
+        if (listDirChildren[i] >= header->listDirs.count) {
+            return invalidRange;
+        }
+    }
+
+    for (uint32_t i = 0; i < header->targets.count; i++) {
+        const CmagBinaryTarget &target = targets[i];
+        if (!isValidString(target.name) || !isValidString(target.listDirName)) {
+            return invalidString;
+        }
+        if (!isValidRange(target.configs, header->configs) || !isValidRange(target.aliases, header->aliases)) {
+            return invalidRange;
+        }
+        if (target.type == static_cast<uint32_t>(CmagTargetType::Invalid) || target.type >= static_cast<uint32_t>(CmagTargetType::COUNT)) {
+            return {ParseResultStatus::InvalidValue, LOG_TO_STRING("Invalid type specified for target ", getString(target.name))};
+        }
+    }
+
+    for (uint32_t i = 0; i < header->configs.count; i++) {
+        if (!isValidString(configs[i].name)) {
+            return invalidString;
+        }
+        if (!isValidRange(configs[i].properties, header->properties)) {
+            return invalidRange;
+        }
+    }
+
+    for (uint32_t i = 0; i < header->properties.count; i++) {
+        if (!isValidString(properties[i].name) || !isValidString(properties[i].value)) {
+            return invalidString;
+        }
+    }
+
+    for (uint32_t i = 0; i < header->aliases.count; i++) {
+        if (!isValidString(aliases[i])) {
+            return invalidString;
+        }
+    }
+
+    return ParseResult::success;
+}
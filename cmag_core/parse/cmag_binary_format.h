@@ -0,0 +1,145 @@
+#pragma once
+
+#include "cmag_core/parse/parse_result.h"
+
+#include <cstdint>
+#include <string_view>
+
+// Binary alternative to the json project file. It is meant for huge projects, where parsing json dominates the
+// startup time of the browser. The file is designed to be mapped into memory and read without any parsing:
+//  - a header with the magic, format version and locations of all the sections,
+//  - a string table containing all strings of the project without zero terminators; each string is stored once,
+//  - fixed-size records for globals, list dirs, targets, configs, properties and aliases.
+// Records refer to strings by an offset and a length within the string table and to other records by a range of
+// indices within their section. All sections are 4-byte aligned. All values are stored little-endian, which is
+// verified via endiannessMarker. Offsets are 32-bit, so the file cannot exceed 4GB.
+
+constexpr inline char cmagBinaryMagic[8] = {'C', 'M', 'A', 'G', 'B', 'I', 'N', '\0'};
+constexpr inline uint32_t cmagBinaryFormatVersion = 1;
+constexpr inline uint32_t cmagBinaryEndiannessMarker = 0x01020304;
+
+struct CmagBinaryString {
+    uint32_t offset; // within the string table
+    uint32_t length;
+};
+
+struct CmagBinarySection {
+    uint32_t offset; // from the beginning of the file
+    uint32_t count;  // number of records or number of bytes for the string table
+};
+
+struct CmagBinaryRange {
+    uint32_t first;
+    uint32_t count;
+};
+
+struct CmagBinaryHeader {
+    char magic[8];
+    uint32_t formatVersion;
+    uint32_t endiannessMarker;
+    CmagBinarySection strings;         // chars
+    CmagBinarySection globals;         // CmagBinaryGlobals, always exactly one
+    CmagBinarySection listDirs;        // CmagBinaryListDir
+    CmagBinarySection listDirChildren; // uint32_t indices of list dirs
+    CmagBinarySection targets;         // CmagBinaryTarget
+    CmagBinarySection configs;         // CmagBinaryConfig
+    CmagBinarySection properties;      // CmagBinaryProperty
+    CmagBinarySection aliases;         // CmagBinaryString
+};
+
+struct CmagBinaryGlobals {
+    CmagBinaryString cmagVersion;
+    CmagBinaryString selectedConfig;
+    CmagBinaryString cmakeVersion;
+    CmagBinaryString cmakeProjectName;
+    CmagBinaryString cmagProjectName;
+    CmagBinaryString sourceDir;
+    CmagBinaryString buildDir;
+    CmagBinaryString generator;
+    CmagBinaryString compilerId;
+    CmagBinaryString compilerVersion;
+    CmagBinaryString os;
+    CmagBinaryString useFolders;
+    CmagBinaryString selectedTargetName;
+    float cameraX;
+    float cameraY;
+    float cameraScale;
+    uint32_t displayedDependencyType;
+    int32_t selectedTabIndex;
+    uint8_t darkMode;
+    uint8_t needsLayout;
+    uint8_t autoSaveEnabled;
+    uint8_t padding;
+};
+
+struct CmagBinaryListDir {
+    CmagBinaryString name;
+    CmagBinaryRange children; // within listDirChildren section
+};
+
+struct CmagBinaryTarget {
+    CmagBinaryString name;
+    CmagBinaryString listDirName;
+    uint32_t type;
+    float x;
+    float y;
+    uint8_t hideConnections;
+    uint8_t isImported;
+    uint16_t padding;
+    CmagBinaryRange configs; // within configs section
+    CmagBinaryRange aliases; // within aliases section
+};
+
+struct CmagBinaryConfig {
+    CmagBinaryString name;
+    CmagBinaryRange properties; // within properties section
+};
+
+struct CmagBinaryProperty {
+    CmagBinaryString name;
+    CmagBinaryString value;
+};
+
+static_assert(sizeof(CmagBinaryHeader) == 80);
+static_assert(sizeof(CmagBinaryGlobals) == 128);
+static_assert(sizeof(CmagBinaryListDir) == 16);
+static_assert(sizeof(CmagBinaryTarget) == 48);
+static_assert(sizeof(CmagBinaryConfig) == 16);
+static_assert(sizeof(CmagBinaryProperty) == 16);
+
+// Validated, read-only view over binary project data. Validation checks bounds of all sections, ranges and strings
+// up front, so accessors can be used without any further checks. Returned strings point directly into the data,
+// so they are valid as long as the underlying memory is.
+class CmagBinaryProjectView {
+public:
+    static bool hasMagic(std::string_view data);
+    ParseResult open(std::string_view data);
+
+    std::string_view getString(CmagBinaryString string) const { return strings.substr(string.offset, string.length); }
+    std::string_view getStrings() const { return strings; }
+    const CmagBinaryGlobals &getGlobals() const { return *globals; }
+    const CmagBinaryListDir *getListDirs() const { return listDirs; }
+    const uint32_t *getListDirChildren() const { return listDirChildren; }
+    const CmagBinaryTarget *getTargets() const { return targets; }
+    const CmagBinaryConfig *getConfigs() const { return configs; }
+    const CmagBinaryProperty *getProperties() const { return properties; }
+    const CmagBinaryString *getAliases() const { return aliases; }
+    const CmagBinaryHeader &getHeader() const { return *header; }
+
+private:
+    template <typename T>
+    ParseResult openSection(std::string_view data, const CmagBinarySection &section, const char *name, const T *&outRecords);
+    bool isValidString(CmagBinaryString string) const;
+    static bool isValidRange(CmagBinaryRange range, const CmagBinarySection &section);
+    ParseResult validateRecords() const;
+
+    const CmagBinaryHeader *header = nullptr;
+    std::string_view strings = {};
+    const CmagBinaryGlobals *globals = nullptr;
+    const CmagBinaryListDir *listDirs = nullptr;
+    const uint32_t *listDirChildren = nullptr;
+    const CmagBinaryTarget *targets = nullptr;
+    const CmagBinaryConfig *configs = nullptr;
+    const CmagBinaryProperty *properties = nullptr;
+    const CmagBinaryString *aliases = nullptr;
+};
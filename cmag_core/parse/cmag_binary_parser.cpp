@@ -0,0 +1,133 @@
+#include "cmag_binary_parser.h"
+
+#include "cmag_core/utils/error.h"
+
+#define RETURN_ERROR(expr)                              \
+    do {                                                \
+        const ParseResult r = (expr);                   \
+        if ((r.status) != ParseResultStatus::Success) { \
+            return (r);                                 \
+        }                                               \
+    } while (false)
+
+ParseResult CmagBinaryParser::parseProject(std::string_view data, CmagProject &outProject, bool lazyPropertyValues) {
+    CmagBinaryProjectView view = {};
+    RETURN_ERROR(view.open(data));
+
+    RETURN_ERROR(parseGlobals(view, outProject.getGlobals()));
+
+    // The string table is deduplicated, so storing it as a whole is cheaper than copying each value separately. Values
+    // are then interned as views into it. Otherwise values are copied when the targets are added to the project.
+    std::string_view rawStrings = {};
+    if (lazyPropertyValues) {
+        rawStrings = outProject.storeRawData(view.getStrings());
+    }
+
+    const CmagBinaryHeader &header = view.getHeader();
+    for (uint32_t targetIndex = 0; targetIndex < header.targets.count; targetIndex++) {
+        const CmagBinaryTarget &record = view.getTargets()[targetIndex];
+        CmagTarget target = {};
+        RETURN_ERROR(parseTarget(view, record, target, outProject, rawStrings));
+        if (!outProject.addTarget(std::move(target))) {
+            return {ParseResultStatus::InvalidValue, LOG_TO_STRING("Failed to add target ", view.getString(record.name), " to the project")};
+        }
+    }
+
+    if (!outProject.deriveData(true)) {
+        // TODO return some meaningful string from data derivation
+        return {ParseResultStatus::DataDerivationFailed, "Data derivation failed"};
+    }
+    return ParseResult::success;
+}
+
+ParseResult CmagBinaryParser::parseGlobals(const CmagBinaryProjectView &view, CmagGlobals &outGlobals) {
+    const CmagBinaryGlobals &record = view.getGlobals();
+
+    const std::optional<CmagVersion> projectVersion = CmagVersion::fromString(std::string{view.getString(record.cmagVersion)});
+    if (!projectVersion.has_value()) {
+        return {ParseResultStatus::InvalidValue, "Could not parse cmag version"};
+    }
+    if (!cmagVersion.isProjectCompatible(projectVersion.value())) {
+        return {
+            ParseResultStatus::VersionMismatch,
+            LOG_TO_STRING("Incompatible cmag version. Current version is ", cmagVersion.toString(), " and project file version is ", projectVersion->toString(), ".")};
+    }
+
+    outGlobals.darkMode = record.darkMode;
+    outGlobals.cmagVersion = projectVersion.value();
+#define PARSE_GLOBAL_FIELD(name) outGlobals.name = view.getString(record.name)
+    PARSE_GLOBAL_FIELD(selectedConfig);
+    PARSE_GLOBAL_FIELD(cmakeVersion);
+    PARSE_GLOBAL_FIELD(cmakeProjectName);
+    PARSE_GLOBAL_FIELD(cmagProjectName);
+    PARSE_GLOBAL_FIELD(sourceDir);
+    PARSE_GLOBAL_FIELD(buildDir);
+    PARSE_GLOBAL_FIELD(generator);
+    PARSE_GLOBAL_FIELD(compilerId);
+    PARSE_GLOBAL_FIELD(compilerVersion);
+    PARSE_GLOBAL_FIELD(os);
+    PARSE_GLOBAL_FIELD(useFolders);
+#undef PARSE_GLOBAL_FIELD
+
+    CmagGlobals::BrowserData &browser = outGlobals.browser;
+    browser.needsLayout = record.needsLayout;
+    browser.autoSaveEnabled = record.autoSaveEnabled;
+    browser.cameraX = record.cameraX;
+    browser.cameraY = record.cameraY;
+    browser.cameraScale = record.cameraScale;
+    browser.displayedDependencyType = static_cast<CmagDependencyType>(record.displayedDependencyType);
+    browser.selectedTabIndex = record.selectedTabIndex;
+    browser.selectedTargetName = view.getString(record.selectedTargetName);
+
+    const CmagBinaryHeader &header = view.getHeader();
+    outGlobals.listDirs.clear();
+    outGlobals.listDirs.reserve(header.listDirs.count);
+    for (uint32_t listDirIndex = 0; listDirIndex < header.listDirs.count; listDirIndex++) {
+        const CmagBinaryListDir &listDirRecord = view.getListDirs()[listDirIndex];
+        CmagListDir &listDir = outGlobals.listDirs.emplace_back();
+        listDir.name = view.getString(listDirRecord.name);
+        const uint32_t *children = view.getListDirChildren() + listDirRecord.children.first;
+        listDir.childIndices.assign(children, children + listDirRecord.children.count);
+    }
+
+    return ParseResult::success;
+}
+
+ParseResult CmagBinaryParser::parseTarget(const CmagBinaryProjectView &view, const CmagBinaryTarget &record, CmagTarget &outTarget, CmagProject &project, std::string_view rawStrings) {
+    CmagPropertyValueTable &propertyValues = project.getPropertyValues();
+
+    outTarget.name = view.getString(record.name);
+    outTarget.type = static_cast<CmagTargetType>(record.type);
+    outTarget.listDirName = view.getString(record.listDirName);
+    outTarget.isImported = record.isImported;
+    outTarget.graphical.x = record.x;
+    outTarget.graphical.y = record.y;
+    outTarget.graphical.hideConnections = record.hideConnections;
+
+    outTarget.configs.reserve(record.configs.count);
+    for (uint32_t configIndex = 0; configIndex < record.configs.count; configIndex++) {
+        const CmagBinaryConfig &configRecord = view.getConfigs()[record.configs.first + configIndex];
+        CmagTargetConfig &config = outTarget.configs.emplace_back();
+        config.name = view.getString(configRecord.name);
+
+        config.properties.reserve(configRecord.properties.count);
+        for (uint32_t propertyIndex = 0; propertyIndex < configRecord.properties.count; propertyIndex++) {
+            const CmagBinaryProperty &propertyRecord = view.getProperties()[configRecord.properties.first + propertyIndex];
+            CmagTargetProperty &property = config.properties.emplace_back();
+            property.name = view.getString(propertyRecord.name);
+            if (rawStrings.empty()) {
+                property.value = view.getString(propertyRecord.value);
+            } else {
+                property.valueId = propertyValues.internExternal(rawStrings.substr(propertyRecord.value.offset, propertyRecord.value.length));
+                property.value = propertyValues.getValue(property.valueId);
+            }
+        }
+    }
+
+    outTarget.aliases.reserve(record.aliases.count);
+    for (uint32_t aliasIndex = 0; aliasIndex < record.aliases.count; aliasIndex++) {
+        outTarget.aliases.emplace_back(view.getString(view.getAliases()[record.aliases.first + aliasIndex]));
+    }
+
+    return ParseResult::success;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "cmag_core/core/cmag_project.h"
+#include "cmag_core/parse/cmag_binary_format.h"
+#include "cmag_core/parse/parse_result.h"
+
+#include <string_view>
+
+class CmagBinaryParser {
+public:
+    // In lazy mode the string table is stored in the project as a whole and values of properties are views into it.
+    // No per-property copies are made. Otherwise each distinct value is copied to the project separately.
+    static ParseResult parseProject(std::string_view data, CmagProject &outProject, bool lazyPropertyValues = false);
+
+private:
+    static ParseResult parseGlobals(const CmagBinaryProjectView &view, CmagGlobals &outGlobals);
+    static ParseResult parseTarget(const CmagBinaryProjectView &view, const CmagBinaryTarget &record, CmagTarget &outTarget, CmagProject &project, std::string_view rawStrings);
+};
@@ -0,0 +1,154 @@
+#include "cmag_binary_writer.h"
+
+#include "cmag_core/utils/error.h"
+
+#include <cstring>
+
+CmagBinaryString CmagBinaryWriter::StringTable::add(std::string_view string) {
+    if (auto it = offsets.find(string); it != offsets.end()) {
+        return it->second;
+    }
+
+    FATAL_ERROR_IF(data.size() + string.size() > UINT32_MAX, "Binary project string table is too big");
+    const CmagBinaryString result{static_cast<uint32_t>(data.size()), static_cast<uint32_t>(string.size())};
+    data.append(string);
+    offsets.emplace(string, result);
+    return result;
+}
+
+void CmagBinaryWriter::writeProject(const CmagProject &project, std::ostream &out) {
+    writeProject(project, project.createBrowserStateSnapshot(), out);
+}
+
+void CmagBinaryWriter::writeProject(const CmagProject &project, const CmagBrowserStateSnapshot &state, std::ostream &out) {
+    FATAL_ERROR_IF(state.targetsGraphical.size() != project.getTargets().size(), "Browser state snapshot does not match the project");
+
+    StringTable strings = {};
+    const CmagGlobals &globals = project.getGlobals();
+
+    // Flatten the project into arrays of fixed-size records
+    const std::string cmagVersionString = globals.cmagVersion.toString(); // must outlive the string table
+    const CmagBinaryGlobals globalsRecord = createGlobalsRecord(globals, state, cmagVersionString, strings);
+
+    std::vector<CmagBinaryListDir> listDirs = {};
+    std::vector<uint32_t> listDirChildren = {};
+    listDirs.reserve(globals.listDirs.size());
+    for (const CmagListDir &listDir : globals.listDirs) {
+        CmagBinaryListDir &record = listDirs.emplace_back();
+        record.name = strings.add(listDir.name);
+        record.children = {static_cast<uint32_t>(listDirChildren.size()), static_cast<uint32_t>(listDir.childIndices.size())};
+        for (size_t childIndex : listDir.childIndices) {
+            listDirChildren.push_back(static_cast<uint32_t>(childIndex));
+        }
+    }
+
+    std::vector<CmagBinaryTarget> targets = {};
+    std::vector<CmagBinaryConfig> configs = {};
+    std::vector<CmagBinaryProperty> properties = {};
+    std::vector<CmagBinaryString> aliases = {};
+    targets.reserve(project.getTargets().size());
+    for (size_t targetIndex = 0; targetIndex < project.getTargets().size(); targetIndex++) {
+        const CmagTarget &target = project.getTargets()[targetIndex];
+        const CmagTargetGraphicalData &graphical = state.targetsGraphical[targetIndex];
+        CmagBinaryTarget &record = targets.emplace_back();
+        record.name = strings.add(target.name);
+        record.listDirName = strings.add(target.listDirName);
+        record.type = static_cast<uint32_t>(target.type);
+        record.x = graphical.x;
+        record.y = graphical.y;
+        record.hideConnections = graphical.hideConnections;
+        record.isImported = target.isImported;
+        record.padding = 0;
+
+        record.configs = {static_cast<uint32_t>(configs.size()), static_cast<uint32_t>(target.configs.size())};
+        for (const CmagTargetConfig &config : target.configs) {
+            CmagBinaryConfig &configRecord = configs.emplace_back();
+            configRecord.name = strings.add(config.name);
+            configRecord.properties = {static_cast<uint32_t>(properties.size()), static_cast<uint32_t>(config.properties.size())};
+            for (const CmagTargetProperty &property : config.properties) {
+                properties.push_back({strings.add(property.name), strings.add(property.getValue())});
+            }
+        }
+
+        record.aliases = {static_cast<uint32_t>(aliases.size()), static_cast<uint32_t>(target.aliases.size())};
+        for (const std::string &alias : target.aliases) {
+            aliases.push_back(strings.add(alias));
+        }
+    }
+
+    // Calculate the layout, so the header can be written before all the sections
+    CmagBinaryHeader header = {};
+    memcpy(header.magic, cmagBinaryMagic, sizeof(cmagBinaryMagic));
+    header.formatVersion = cmagBinaryFormatVersion;
+    header.endiannessMarker = cmagBinaryEndiannessMarker;
+    size_t offset = sizeof(CmagBinaryHeader);
+    placeSection<CmagBinaryGlobals>(1, header.globals, offset);
+    placeSection<CmagBinaryListDir>(listDirs.size(), header.listDirs, offset);
+    placeSection<uint32_t>(listDirChildren.size(), header.listDirChildren, offset);
+    placeSection<CmagBinaryTarget>(targets.size(), header.targets, offset);
+    placeSection<CmagBinaryConfig>(configs.size(), header.configs, offset);
+    placeSection<CmagBinaryProperty>(properties.size(), header.properties, offset);
+    placeSection<CmagBinaryString>(aliases.size(), header.aliases, offset);
+    placeSection<char>(strings.getData().size(), header.strings, offset);
+
+    // Write everything
+    offset = 0;
+    writeSection(out, &header, {0, 1}, offset);
+    writeSection(out, &globalsRecord, header.globals, offset);
+    writeSection(out, listDirs.data(), header.listDirs, offset);
+    writeSection(out, listDirChildren.data(), header.listDirChildren, offset);
+    writeSection(out, targets.data(), header.targets, offset);
+    writeSection(out, configs.data(), header.configs, offset);
+    writeSection(out, properties.data(), header.properties, offset);
+    writeSection(out, aliases.data(), header.aliases, offset);
+    writeSection(out, strings.getData().data(), header.strings, offset);
+}
+
+CmagBinaryGlobals CmagBinaryWriter::createGlobalsRecord(const CmagGlobals &globals, const CmagBrowserStateSnapshot &state, std::string_view cmagVersionString, StringTable &strings) {
+    CmagBinaryGlobals record = {};
+    record.cmagVersion = strings.add(cmagVersionString);
+    record.selectedConfig = strings.add(state.selectedConfig);
+    record.cmakeVersion = strings.add(globals.cmakeVersion);
+    record.cmakeProjectName = strings.add(globals.cmakeProjectName);
+    record.cmagProjectName = strings.add(globals.cmagProjectName);
+    record.sourceDir = strings.add(globals.sourceDir);
+    record.buildDir = strings.add(globals.buildDir);
+    record.generator = strings.add(globals.generator);
+    record.compilerId = strings.add(globals.compilerId);
+    record.compilerVersion = strings.add(globals.compilerVersion);
+    record.os = strings.add(globals.os);
+    record.useFolders = strings.add(globals.useFolders);
+    record.selectedTargetName = strings.add(state.browser.selectedTargetName);
+    record.cameraX = state.browser.cameraX;
+    record.cameraY = state.browser.cameraY;
+    record.cameraScale = state.browser.cameraScale;
+    record.displayedDependencyType = static_cast<uint32_t>(state.browser.displayedDependencyType);
+    record.selectedTabIndex = state.browser.selectedTabIndex;
+    record.darkMode = state.darkMode;
+    record.needsLayout = state.browser.needsLayout;
+    record.autoSaveEnabled = state.browser.autoSaveEnabled;
+    return record;
+}
+
+template <typename T>
+void CmagBinaryWriter::placeSection(size_t count, CmagBinarySection &outSection, size_t &inOutOffset) {
+    // Keep every section 4-byte aligned, so records can be accessed in place after mapping the file
+    constexpr size_t alignment = 4;
+    static_assert(alignof(T) <= alignment);
+    inOutOffset = (inOutOffset + alignment - 1) / alignment * alignment;
+
+    const size_t size = count * sizeof(T);
+    FATAL_ERROR_IF(inOutOffset + size > UINT32_MAX, "Binary project file is too big");
+    outSection = {static_cast<uint32_t>(inOutOffset), static_cast<uint32_t>(count)};
+    inOutOffset += size;
+}
+
+template <typename T>
+void CmagBinaryWriter::writeSection(std::ostream &out, const T *records, const CmagBinarySection &section, size_t &inOutOffset) {
+    const char padding[4] = {};
+    out.write(padding, static_cast<std::streamsize>(section.offset - inOutOffset));
+
+    const size_t size = section.count * sizeof(T);
+    out.write(reinterpret_cast<const char *>(records), static_cast<std::streamsize>(size));
+    inOutOffset = section.offset + size;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "cmag_core/core/cmag_project.h"
+#include "cmag_core/parse/cmag_binary_format.h"
+
+#include <ostream>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class CmagBinaryWriter {
+public:
+    static void writeProject(const CmagProject &project, std::ostream &out);
+    static void writeProject(const CmagProject &project, const CmagBrowserStateSnapshot &state, std::ostream &out);
+
+private:
+    class StringTable {
+    public:
+        CmagBinaryString add(std::string_view string);
+        const auto &getData() const { return data; }
+
+    private:
+        std::string data = {};
+        std::unordered_map<std::string_view, CmagBinaryString> offsets = {}; // keys point to the project strings
+    };
+
+    static CmagBinaryGlobals createGlobalsRecord(const CmagGlobals &globals, const CmagBrowserStateSnapshot &state, std::string_view cmagVersionString, StringTable &strings);
+
+    template <typename T>
+    static void placeSection(size_t count, CmagBinarySection &outSection, size_t &inOutOffset);
+    template <typename T>
+    static void writeSection(std::ostream &out, const T *records, const CmagBinarySection &section, size_t &inOutOffset);
+};
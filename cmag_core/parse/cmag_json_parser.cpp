@@ -1,6 +1,13 @@
 #include "cmag_json_parser.h"
 
 #include "cmag_core/parse/enum_serialization.h"
+#include "cmag_core/utils/string_utils.h"
+#include "cmag_core/utils/thread_pool.h"
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <unordered_map>
 
 #define RETURN_ERROR(expr)                              \
     do {                                                \
@@ -10,19 +17,10 @@
         }                                               \
     } while (false)
 
-ParseResult::ParseResult(ParseResultStatus status, const std::string &errorMessage)
-    : status(status),
-      errorMessage(errorMessage) {
-    const bool isSuccess = status == ParseResultStatus::Success;
-    FATAL_ERROR_IF(isSuccess != errorMessage.empty(), "Invalid parse result");
-}
-
-const ParseResult ParseResult::success(ParseResultStatus::Success, "");
-
 template <>
-ParseResult CmagJsonParser::parseObjectField<CmagVersion>(const nlohmann::json &node, const char *name, CmagVersion &dst) {
-    if (auto it = node.find(name); it != node.end()) {
-        std::string dstString = it->get<std::string>();
+ParseResult CmagJsonParser::parseFieldValue<CmagVersion>(const nlohmann::json *valueNode, const char *name, CmagVersion &dst) {
+    if (valueNode != nullptr) {
+        std::string dstString = valueNode->get<std::string>();
         std::optional<CmagVersion> version = CmagVersion::fromString(dstString);
         if (version.has_value()) {
             dst = version.value();
@@ -36,15 +34,33 @@ ParseResult CmagJsonParser::parseObjectField<CmagVersion>(const nlohmann::json &
 }
 
 template <typename DstT>
-ParseResult CmagJsonParser::parseObjectField(const nlohmann::json &node, const char *name, DstT &dst) {
-    if (auto it = node.find(name); it != node.end()) {
-        dst = it->get<DstT>();
+ParseResult CmagJsonParser::parseFieldValue(const nlohmann::json *valueNode, const char *name, DstT &dst) {
+    if (valueNode != nullptr) {
+        dst = valueNode->get<DstT>();
         return ParseResult::success;
     } else {
         return {ParseResultStatus::MissingField, LOG_TO_STRING("Missing ", name, " field")};
     }
 }
 
+template <typename DstT>
+ParseResult CmagJsonParser::parseObjectField(const nlohmann::json &node, const char *name, DstT &dst) {
+    auto it = node.find(name);
+    return parseFieldValue(it != node.end() ? &*it : nullptr, name, dst);
+}
+
+template <typename DstT>
+ParseResult CmagJsonParser::parseObjectField(const SaxFields &fields, const char *name, DstT &dst) {
+    auto it = fields.find(name);
+    return parseFieldValue(it != fields.end() ? &it->second : nullptr, name, dst);
+}
+
+// Target parsed independently of other targets. Errors are stored, so they can be reported in a deterministic order.
+struct CmagJsonParser::ParsedTarget {
+    ParseResult result;
+    CmagTarget target;
+};
+
 ParseResult CmagJsonParser::parseTargetsFilesListFile(std::string_view json, std::vector<std::string> &outFileNames) {
     const nlohmann::json node = nlohmann::json::parse(json, nullptr, false);
     if (node.is_discarded()) {
@@ -65,22 +81,33 @@ ParseResult CmagJsonParser::parseTargetsFilesListFile(std::string_view json, std
     return ParseResult::success;
 }
 
-ParseResult CmagJsonParser::parseGlobalsFile(std::string_view json, CmagGlobals &outGlobals) {
-    const nlohmann::json node = nlohmann::json::parse(json, nullptr, false);
-    if (node.is_discarded()) {
-        return {ParseResultStatus::Malformed, "File is malformed"};
+static void storeTargetStrings(CmagTarget &target, std::pmr::memory_resource *memoryResource) {
+    for (CmagTargetConfig &config : target.configs) {
+        for (CmagTargetProperty &property : config.properties) {
+            property.name = storeString(property.name, memoryResource);
+            property.value = storeString(property.value, memoryResource);
+        }
     }
+}
 
-    if (!node.is_object()) {
-        return {ParseResultStatus::InvalidNodeType, "Root node should be an object"};
+ParseResult CmagJsonParser::parseTargetsFile(std::string_view json, std::vector<CmagTarget> &outTargets, std::pmr::memory_resource *memoryResource, bool multithreaded) {
+    // Root node is an object of targets, which are parsed concurrently, if the file is well-formed. Otherwise the
+    // file is parsed as a whole to report the errors. Targets of a DOM are sorted by name, so the map yields the same
+    // order of targets and errors.
+    CmagJsonStructureIndex index = {};
+    std::vector<CmagJsonStructureIndex::Member> members = {};
+    std::map<std::string, ParsedTarget> parsedTargets = {};
+    std::vector<std::unique_ptr<std::pmr::monotonic_buffer_resource>> chunksMemoryResources = {};
+    if (index.build(json) && index.collectRootMembers(members) && parseTargetsConcurrently(members, false, multithreaded, nullptr, chunksMemoryResources, parsedTargets)) {
+        for (auto &[targetName, parsedTarget] : parsedTargets) {
+            RETURN_ERROR(parsedTarget.result);
+            // Memory of the chunks is released on return, so strings are moved to the memory of the caller.
+            storeTargetStrings(parsedTarget.target, memoryResource);
+            outTargets.push_back(std::move(parsedTarget.target));
+        }
+        return ParseResult::success;
     }
 
-    RETURN_ERROR(parseGlobalValues(node, outGlobals));
-
-    return ParseResult::success;
-}
-
-ParseResult CmagJsonParser::parseTargetsFile(std::string_view json, std::vector<CmagTarget> &outTargets) {
     const nlohmann::json node = nlohmann::json::parse(json, nullptr, false);
     if (node.is_discarded()) {
         return {ParseResultStatus::Malformed, "File is malformed"};
@@ -89,7 +116,9 @@ ParseResult CmagJsonParser::parseTargetsFile(std::string_view json, std::vector<
         return {ParseResultStatus::InvalidNodeType, "Root node should be an object"};
     }
 
-    return parseTargets(node, outTargets, false);
+    // Targets in different configs usually have the same non-evaled genexes, so they are parsed only once.
+    CmagGenexCache genexCache{};
+    return parseTargets(node, outTargets, memoryResource, &genexCache);
 }
 
 ParseResult CmagJsonParser::parseAliasesFile(std::string_view json, std::vector<std::pair<std::string, std::string>> &outAliases) {
@@ -111,53 +140,623 @@ ParseResult CmagJsonParser::parseAliasesFile(std::string_view json, std::vector<
     return ParseResult::success;
 }
 
-ParseResult CmagJsonParser::parseProject(std::string_view json, CmagProject &outProject) {
-    const nlohmann::json node = nlohmann::json::parse(json, nullptr, false);
-    if (node.is_discarded()) {
-        return {ParseResultStatus::Malformed, "File is malformed"};
+// Nodes of a project file parsed by the SAX handler. Strings of properties, aliases and list dirs are stored right
+// away. Other fields are kept as single json values and validated only after their whole node is parsed, so they're
+// converted just like in a DOM and the errors are reported in the same order, regardless of the order of keys. Fields
+// holding containers are kept as empty containers, because only their type is ever checked.
+struct CmagJsonParser::SaxObjectNode {
+    bool isObject = false;
+    SaxFields fields = {};
+};
+
+struct CmagJsonParser::SaxListDirsNode {
+    struct ListDir {
+        bool isArray = false;
+        std::vector<std::optional<std::string>> children = {}; // nullopt for values other than strings
+    };
+
+    bool isObject = false;
+    std::map<std::string, ListDir> listDirs = {};
+};
+
+struct CmagJsonParser::SaxGlobalsNode {
+    bool isObject = false;
+    SaxFields fields = {};
+    std::optional<SaxObjectNode> browser = {};
+    std::optional<SaxListDirsNode> listDirs = {};
+};
+
+struct CmagJsonParser::SaxTargetNode {
+    struct Config {
+        CmagTargetConfig config = {};
+        bool isObject = false;
+        std::vector<std::pair<size_t, nlohmann::json>> nonStringValues = {}; // keyed by index of the property
+    };
+
+    bool isObject = false;
+    SaxFields fields = {};
+    bool hasConfigs = false;
+    bool isConfigsObject = false;
+    std::vector<Config> configs = {};
+    std::optional<SaxObjectNode> graphical = {};
+    bool hasAliases = false;
+    bool isAliasesArray = false;
+    bool hasNonStringAlias = false;
+    std::vector<std::string> aliases = {};
+};
+
+// Intermediate results of parsing a project file. Errors are not reported immediately. We keep on parsing and report
+// them in the end in the same order as if the whole file was parsed at once, e.g. a malformed file has to be reported
+// as malformed, even if an invalid target was encountered earlier.
+struct CmagJsonParser::ParsedProject {
+    bool isRootObject = false;
+    bool hasGlobals = false;
+    SaxGlobalsNode globals = {};
+    bool hasTargets = false;
+    bool isTargetsObject = false;
+    std::map<std::string, ParsedTarget> targets = {};
+    std::string_view rawJson = {}; // set in lazy mode, values of properties may point into it
+
+    // Strings of the targets are stored here only until the targets are added to the project, which interns them.
+    std::vector<std::unique_ptr<std::pmr::monotonic_buffer_resource>> memoryResources = {};
+    std::pmr::memory_resource *createMemoryResource() {
+        return memoryResources.emplace_back(std::make_unique<std::pmr::monotonic_buffer_resource>()).get();
     }
 
-    if (!node.is_object()) {
-        return {ParseResultStatus::InvalidNodeType, "Root node should be an object"};
+    // Values pointing into the parsed json are moved to the copy of it stored in the project. They're interned without
+    // any further copies.
+    void adoptStoredPropertyValues(std::string_view storedJson, CmagTarget &target, CmagPropertyValueTable &propertyValues) const {
+        const char *rawJsonEnd = rawJson.data() + rawJson.size();
+        for (CmagTargetConfig &config : target.configs) {
+            for (CmagTargetProperty &property : config.properties) {
+                if (property.value.empty() || property.value.data() < rawJson.data() || property.value.data() >= rawJsonEnd) {
+                    continue;
+                }
+                const auto offset = static_cast<size_t>(property.value.data() - rawJson.data());
+                property.valueId = propertyValues.internExternal(storedJson.substr(offset, property.value.size()));
+                property.value = propertyValues.getValue(property.valueId);
+            }
+        }
     }
 
-    RETURN_ERROR(validateVersion(node));
+    ParseResult finalize(CmagProject &outProject) {
+        if (!isRootObject) {
+            return {ParseResultStatus::InvalidNodeType, "Root node should be an object"};
+        }
 
-    if (auto globalsNodeIt = node.find("globals"); globalsNodeIt != node.end()) {
-        RETURN_ERROR(parseGlobalValues(*globalsNodeIt, outProject.getGlobals()));
-    } else {
-        return {ParseResultStatus::MissingField, "Missing globals node"};
-    }
+        if (!hasGlobals) {
+            return {ParseResultStatus::MissingField, "Could not find cmag version"};
+        }
+        RETURN_ERROR(validateVersion(globals));
+        RETURN_ERROR(parseGlobalValues(globals, outProject.getGlobals()));
+
+        if (!hasTargets) {
+            return {ParseResultStatus::MissingField, "Missing targets node"};
+        }
+        if (!isTargetsObject) {
+            return {ParseResultStatus::InvalidNodeType, "Targets node should be an object"};
+        }
 
-    if (auto targetsNodeIt = node.find("targets"); targetsNodeIt != node.end()) {
-        std::vector<CmagTarget> targets{};
-        RETURN_ERROR(parseTargets(*targetsNodeIt, targets, true));
-        for (CmagTarget &target : targets) {
-            const std::string targetName = target.name;
-            bool addResult = outProject.addTarget(std::move(target));
+        // Targets are held in a sorted map, so we report the errors in the same order as the DOM parser.
+        for (const auto &[targetName, parsedTarget] : targets) {
+            RETURN_ERROR(parsedTarget.result);
+        }
+        const std::string_view storedJson = rawJson.empty() ? std::string_view{} : outProject.storeRawData(rawJson);
+        for (auto &[targetName, parsedTarget] : targets) {
+            if (!storedJson.empty()) {
+                adoptStoredPropertyValues(storedJson, parsedTarget.target, outProject.getPropertyValues());
+            }
+            bool addResult = outProject.addTarget(std::move(parsedTarget.target));
             if (!addResult) {
                 return {ParseResultStatus::MissingField, LOG_TO_STRING("Failed to add target ", targetName, " to the project")};
             }
         }
-    } else {
-        return {ParseResultStatus::MissingField, "Missing targets node"};
+        return ParseResult::success;
+    }
+};
+
+// Parses project files as a stream of SAX events without building a DOM of any part of the file. Each container is
+// pushed as a node, which routes its values either to the globals or to the target being parsed. Targets are validated
+// as soon as they're complete, globals are validated when finalizing the project. The same handler parses standalone
+// globals nodes and single targets, which are split from the file by the concurrent parser.
+class CmagJsonParser::ProjectSaxHandler : public nlohmann::json_sax<nlohmann::json> {
+public:
+    enum class NodeType {
+        ProjectDocument,
+        GlobalsDocument,
+        TargetDocument,
+        Project,
+        Globals,
+        GlobalsBrowser,
+        GlobalsListDirs,
+        GlobalsListDirChildren,
+        Targets,
+        Target,
+        TargetConfigs,
+        TargetConfig,
+        TargetGraphical,
+        TargetAliases,
+        Skipped, // contents of unknown or invalid values
+    };
+
+    ProjectSaxHandler(NodeType documentType, std::pmr::memory_resource *memoryResource, ParsedProject &outProject)
+        : memoryResource(memoryResource), project(&outProject), targets(outProject.targets) {
+        nodes.push_back({documentType});
+    }
+    ProjectSaxHandler(std::string_view targetName, std::pmr::memory_resource *memoryResource, std::map<std::string, ParsedTarget> &outTargets)
+        : memoryResource(memoryResource), targets(outTargets) {
+        nodes.push_back({NodeType::TargetDocument, std::string{targetName}});
+    }
+
+    bool null() override {
+        return onScalar(nullptr);
+    }
+    bool boolean(bool val) override {
+        return onScalar(val);
+    }
+    bool number_integer(number_integer_t val) override {
+        return onScalar(val);
+    }
+    bool number_unsigned(number_unsigned_t val) override {
+        return onScalar(val);
+    }
+    bool number_float(number_float_t val, const string_t &) override {
+        return onScalar(val);
+    }
+    bool string(string_t &val) override {
+        Node &node = nodes.back();
+        switch (node.type) {
+        case NodeType::TargetConfig:
+            currentConfig->config.properties.push_back(CmagTargetProperty{
+                storeString(node.key, memoryResource),
+                storeString(val, memoryResource),
+            });
+            return true;
+        case NodeType::GlobalsListDirChildren:
+            currentListDir->children.emplace_back(val);
+            return true;
+        case NodeType::TargetAliases:
+            target.aliases.push_back(val);
+            return true;
+        default:
+            return onScalar(val);
+        }
+    }
+    bool binary(binary_t &val) override {
+        return onScalar(nlohmann::json::binary(std::move(val)));
+    }
+
+    bool start_object(std::size_t) override {
+        return onContainerStart(ValueType::Object);
+    }
+    bool key(string_t &val) override {
+        nodes.back().key = val; // copied, so the key can reuse its memory
+        return true;
+    }
+    bool end_object() override {
+        return onContainerEnd();
+    }
+
+    bool start_array(std::size_t) override {
+        return onContainerStart(ValueType::Array);
+    }
+    bool end_array() override {
+        return onContainerEnd();
+    }
+
+    bool parse_error(std::size_t, const std::string &, const nlohmann::detail::exception &) override {
+        return false;
+    }
+
+private:
+    enum class ValueType {
+        Scalar,
+        Object,
+        Array,
+    };
+
+    struct Node {
+        NodeType type;
+        std::string key = {}; // key of the current value for objects
+    };
+
+    bool onScalar(nlohmann::json &&value) {
+        onValue(ValueType::Scalar, std::move(value));
+        onValueEnd();
+        return true;
+    }
+
+    bool onContainerStart(ValueType valueType) {
+        const NodeType nodeType = onValue(valueType, {});
+        nodes.push_back({nodeType});
+        return true;
+    }
+
+    bool onContainerEnd() {
+        nodes.pop_back();
+        onValueEnd();
+        return true;
+    }
+
+    // Handles a value of the current node, other than the strings stored directly in the model. Returns type of the
+    // node to push, if the value is a container.
+    NodeType onValue(ValueType valueType, nlohmann::json &&value) {
+        const bool isObject = valueType == ValueType::Object;
+        const bool isArray = valueType == ValueType::Array;
+        const Node &parent = nodes.back();
+        switch (parent.type) {
+        case NodeType::ProjectDocument:
+            project->isRootObject = isObject;
+            return isObject ? NodeType::Project : NodeType::Skipped;
+        case NodeType::GlobalsDocument:
+            return startGlobals(isObject);
+        case NodeType::TargetDocument:
+        case NodeType::Targets:
+            target = {};
+            target.isObject = isObject;
+            return isObject ? NodeType::Target : NodeType::Skipped;
+
+        case NodeType::Project:
+            // Duplicated keys overwrite previous values, just like in the DOM parser.
+            if (parent.key == "globals") {
+                return startGlobals(isObject);
+            }
+            if (parent.key == "targets") {
+                project->hasTargets = true;
+                project->isTargetsObject = isObject;
+                targets.clear();
+                return isObject ? NodeType::Targets : NodeType::Skipped;
+            }
+            return NodeType::Skipped;
+
+        case NodeType::Globals:
+            if (parent.key == "browser") {
+                project->globals.browser = SaxObjectNode{isObject};
+                return isObject ? NodeType::GlobalsBrowser : NodeType::Skipped;
+            }
+            if (parent.key == "listDirs") {
+                project->globals.listDirs = SaxListDirsNode{isObject};
+                return isObject ? NodeType::GlobalsListDirs : NodeType::Skipped;
+            }
+            return storeField(project->globals.fields, parent.key, valueType, std::move(value));
+        case NodeType::GlobalsBrowser:
+            return storeField(project->globals.browser->fields, parent.key, valueType, std::move(value));
+        case NodeType::GlobalsListDirs:
+            currentListDir = &project->globals.listDirs->listDirs.insert_or_assign(parent.key, SaxListDirsNode::ListDir{isArray}).first->second;
+            return isArray ? NodeType::GlobalsListDirChildren : NodeType::Skipped;
+        case NodeType::GlobalsListDirChildren:
+            currentListDir->children.emplace_back();
+            return NodeType::Skipped;
+
+        case NodeType::Target:
+            if (parent.key == "configs") {
+                target.hasConfigs = true;
+                target.isConfigsObject = isObject;
+                target.configs.clear();
+                return isObject ? NodeType::TargetConfigs : NodeType::Skipped;
+            }
+            if (parent.key == "graphical") {
+                target.graphical = SaxObjectNode{isObject};
+                return isObject ? NodeType::TargetGraphical : NodeType::Skipped;
+            }
+            if (parent.key == "aliases") {
+                target.hasAliases = true;
+                target.isAliasesArray = isArray;
+                target.hasNonStringAlias = false;
+                target.aliases.clear();
+                return isArray ? NodeType::TargetAliases : NodeType::Skipped;
+            }
+            return storeField(target.fields, parent.key, valueType, std::move(value));
+        case NodeType::TargetConfigs:
+            currentConfig = &startConfig(parent.key, isObject);
+            return isObject ? NodeType::TargetConfig : NodeType::Skipped;
+        case NodeType::TargetConfig:
+            // The property is kept, so a duplicated key can still overwrite the invalid value.
+            currentConfig->nonStringValues.emplace_back(currentConfig->config.properties.size(), createFieldValue(valueType, std::move(value)));
+            currentConfig->config.properties.push_back(CmagTargetProperty{storeString(parent.key, memoryResource)});
+            return NodeType::Skipped;
+        case NodeType::TargetGraphical:
+            return storeField(target.graphical->fields, parent.key, valueType, std::move(value));
+        case NodeType::TargetAliases:
+            target.hasNonStringAlias = true;
+            return NodeType::Skipped;
+
+        case NodeType::Skipped:
+            return NodeType::Skipped;
+        }
+        return NodeType::Skipped;
+    }
+
+    void onValueEnd() {
+        const Node &parent = nodes.back();
+        if (parent.type != NodeType::Targets && parent.type != NodeType::TargetDocument) {
+            return;
+        }
+
+        const std::string &targetName = parent.key;
+        ParsedTarget parsedTarget{ParseResult::success, CmagTarget{}};
+        parsedTarget.target.name = targetName;
+        if (targetName.empty()) {
+            parsedTarget.result = {ParseResultStatus::InvalidValue, "Target name is empty"};
+        } else {
+            parsedTarget.result = parseTarget(target, parsedTarget.target);
+        }
+        targets.insert_or_assign(targetName, std::move(parsedTarget));
     }
 
-    if (!outProject.deriveData()) {
+    NodeType startGlobals(bool isObject) {
+        project->hasGlobals = true;
+        project->globals = {};
+        project->globals.isObject = isObject;
+        return isObject ? NodeType::Globals : NodeType::Skipped;
+    }
+
+    SaxTargetNode::Config &startConfig(const std::string &configName, bool isObject) {
+        auto configIt = std::find_if(target.configs.begin(), target.configs.end(), [&](const SaxTargetNode::Config &config) {
+            return config.config.name == configName;
+        });
+        SaxTargetNode::Config &config = configIt != target.configs.end() ? *configIt : target.configs.emplace_back();
+        config = {};
+        config.config.name = configName;
+        config.isObject = isObject;
+        return config;
+    }
+
+    static nlohmann::json createFieldValue(ValueType valueType, nlohmann::json &&value) {
+        switch (valueType) {
+        case ValueType::Object:
+            return nlohmann::json::object();
+        case ValueType::Array:
+            return nlohmann::json::array();
+        default:
+            return std::move(value);
+        }
+    }
+
+    static NodeType storeField(SaxFields &fields, const std::string &name, ValueType valueType, nlohmann::json &&value) {
+        fields.insert_or_assign(name, createFieldValue(valueType, std::move(value)));
+        return NodeType::Skipped;
+    }
+
+    std::pmr::memory_resource *memoryResource;
+    ParsedProject *project = nullptr; // not set when parsing a single target
+    std::map<std::string, ParsedTarget> &targets;
+    std::vector<Node> nodes = {};
+    SaxTargetNode target = {};
+    SaxTargetNode::Config *currentConfig = nullptr;
+    SaxListDirsNode::ListDir *currentListDir = nullptr;
+};
+
+ParseResult CmagJsonParser::parseProject(std::string_view json, CmagProject &outProject, bool lazyPropertyValues) {
+    // Well-formed files are split into targets, which are parsed concurrently. Anything unusual falls back to the
+    // sequential parser, which reports the errors.
+    ParsedProject parsedProject = {};
+    if (!parseProjectConcurrently(json, lazyPropertyValues, parsedProject)) {
+        parsedProject = {};
+        ProjectSaxHandler handler{ProjectSaxHandler::NodeType::ProjectDocument, parsedProject.createMemoryResource(), parsedProject};
+        const bool parseSuccess = nlohmann::json::sax_parse(json, &handler);
+        if (!parseSuccess) {
+            return {ParseResultStatus::Malformed, "File is malformed"};
+        }
+    }
+
+    RETURN_ERROR(parsedProject.finalize(outProject));
+
+    if (!outProject.deriveData(true)) {
         // TODO return some meaningful string from data derivation
         return {ParseResultStatus::DataDerivationFailed, "Data derivation failed"};
     }
     return ParseResult::success;
 }
 
-ParseResult CmagJsonParser::validateVersion(const nlohmann::json &node) {
-    auto globalsNodeIt = node.find("globals");
-    if (globalsNodeIt == node.end()) {
-        return {ParseResultStatus::MissingField, "Could not find cmag version"};
+ParseResult CmagJsonParser::parseGlobalsFile(std::string_view json, CmagGlobals &outGlobals) {
+    ParsedProject parsedProject = {};
+    ProjectSaxHandler handler{ProjectSaxHandler::NodeType::GlobalsDocument, nullptr, parsedProject};
+    if (!nlohmann::json::sax_parse(json, &handler)) {
+        return {ParseResultStatus::Malformed, "File is malformed"};
     }
 
+    if (!parsedProject.globals.isObject) {
+        return {ParseResultStatus::InvalidNodeType, "Root node should be an object"};
+    }
+
+    RETURN_ERROR(parseGlobalValues(parsedProject.globals, outGlobals));
+
+    return ParseResult::success;
+}
+
+bool CmagJsonParser::parseProjectConcurrently(std::string_view json, bool lazyPropertyValues, ParsedProject &outParsedProject) {
+    CmagJsonStructureIndex index = {};
+    std::vector<CmagJsonStructureIndex::Member> rootMembers = {};
+    if (!index.build(json) || !index.collectRootMembers(rootMembers)) {
+        return false;
+    }
+    outParsedProject.isRootObject = true;
+
+    // Values other than targets are small, so they're parsed right away. They have to be valid even if they're not
+    // used, just like in the sequential parser.
+    std::vector<CmagJsonStructureIndex::Member> targetMembers = {};
+    for (const CmagJsonStructureIndex::Member &member : rootMembers) {
+        const nlohmann::json keyNode = nlohmann::json::parse(member.key, nullptr, false);
+        if (!keyNode.is_string()) {
+            return false;
+        }
+        const std::string &key = keyNode.get_ref<const std::string &>();
+
+        if (key == "globals") {
+            ProjectSaxHandler handler{ProjectSaxHandler::NodeType::GlobalsDocument, nullptr, outParsedProject};
+            if (!nlohmann::json::sax_parse(member.value, &handler)) {
+                return false;
+            }
+        } else if (key == "targets") {
+            if (outParsedProject.hasTargets) {
+                return false; // duplicated targets would have to be validated too, leave it to the sequential parser
+            }
+            outParsedProject.hasTargets = true;
+            outParsedProject.isTargetsObject = index.isObject(member.valueStructuralIndex);
+            if (outParsedProject.isTargetsObject) {
+                if (!index.collectObjectMembers(member.valueStructuralIndex, targetMembers)) {
+                    return false;
+                }
+            } else if (!nlohmann::json::accept(member.value)) {
+                return false;
+            }
+        } else if (!nlohmann::json::accept(member.value)) {
+            return false;
+        }
+    }
+
+    // The json is copied to the project only after the parsing succeeds, so it's not wasted when falling back to the
+    // sequential parser.
+    if (lazyPropertyValues) {
+        outParsedProject.rawJson = json;
+    }
+    return parseTargetsConcurrently(targetMembers, true, true, lazyPropertyValues ? &index : nullptr, outParsedProject.memoryResources, outParsedProject.targets);
+}
+
+bool CmagJsonParser::parseTargetsConcurrently(const std::vector<CmagJsonStructureIndex::Member> &members,
+                                              bool isProjectFile,
+                                              bool multithreaded,
+                                              const CmagJsonStructureIndex *rawValuesIndex,
+                                              std::vector<std::unique_ptr<std::pmr::monotonic_buffer_resource>> &outMemoryResources,
+                                              std::map<std::string, ParsedTarget> &outTargets) {
+    // Targets are split into contiguous chunks. Each chunk is parsed on one thread with its own genex cache and memory
+    // resource, because neither of them is thread-safe. Small files, or files parsed when the caller is already running
+    // on multiple threads, are parsed in a single chunk without any threads. Memory resources are returned to the
+    // caller, because strings of the parsed targets are stored in them.
+    constexpr size_t minTargetsPerChunk = 128;
+    const size_t maxChunksCount = multithreaded ? ThreadPool::getDefaultThreadsCount() : 1;
+    const size_t chunksCount = std::clamp<size_t>(members.size() / minTargetsPerChunk, 1, maxChunksCount);
+    std::vector<std::pmr::memory_resource *> memoryResources(chunksCount);
+    for (size_t chunkIndex = 0; chunkIndex < chunksCount; chunkIndex++) {
+        memoryResources[chunkIndex] = outMemoryResources.emplace_back(std::make_unique<std::pmr::monotonic_buffer_resource>()).get();
+    }
+
+    struct Chunk {
+        std::map<std::string, ParsedTarget> targets = {};
+        bool isMalformed = false;
+    };
+    std::vector<Chunk> chunks(chunksCount);
+    auto parseChunk = [&](size_t chunkIndex) {
+        Chunk &chunk = chunks[chunkIndex];
+        CmagGenexCache genexCache{};
+        const size_t membersBegin = members.size() * chunkIndex / chunksCount;
+        const size_t membersEnd = members.size() * (chunkIndex + 1) / chunksCount;
+        for (size_t memberIndex = membersBegin; memberIndex < membersEnd; memberIndex++) {
+            const CmagJsonStructureIndex::Member &member = members[memberIndex];
+            const nlohmann::json keyNode = nlohmann::json::parse(member.key, nullptr, false);
+            if (!keyNode.is_string()) {
+                chunk.isMalformed = true;
+                return;
+            }
+            const std::string &targetName = keyNode.get_ref<const std::string &>();
+
+            if (isProjectFile) {
+                ProjectSaxHandler handler{targetName, memoryResources[chunkIndex], chunk.targets};
+                if (!nlohmann::json::sax_parse(member.value, &handler)) {
+                    chunk.isMalformed = true;
+                    return;
+                }
+            } else {
+                const nlohmann::json valueNode = nlohmann::json::parse(member.value, nullptr, false);
+                if (valueNode.is_discarded()) {
+                    chunk.isMalformed = true;
+                    return;
+                }
+
+                ParsedTarget parsedTarget{ParseResult::success, CmagTarget{}};
+                parsedTarget.target.name = targetName;
+                if (targetName.empty()) {
+                    parsedTarget.result = {ParseResultStatus::InvalidValue, "Target name is empty"};
+                } else {
+                    parsedTarget.result = parseTarget(valueNode, parsedTarget.target, memoryResources[chunkIndex], &genexCache);
+                }
+                chunk.targets.insert_or_assign(targetName, std::move(parsedTarget));
+            }
+
+            ParsedTarget &parsedTarget = chunk.targets.find(targetName)->second;
+            if (rawValuesIndex != nullptr && parsedTarget.result.status == ParseResultStatus::Success) {
+                adoptRawPropertyValues(*rawValuesIndex, member.valueStructuralIndex, parsedTarget.target);
+            }
+        }
+    };
+    if (chunksCount == 1) {
+        parseChunk(0);
+    } else {
+        ThreadPool threadPool{chunksCount};
+        threadPool.parallelFor(chunksCount, parseChunk);
+    }
+
+    // Merge in file order, so duplicated targets overwrite previous ones, just like in the DOM parser.
+    for (Chunk &chunk : chunks) {
+        if (chunk.isMalformed) {
+            return false;
+        }
+        for (auto &[targetName, parsedTarget] : chunk.targets) {
+            outTargets.insert_or_assign(targetName, std::move(parsedTarget));
+        }
+    }
+    return true;
+}
+
+// Returns contents of a raw json string, if they're the same as its decoded value, i.e. there are no escape sequences.
+static std::optional<std::string_view> getUnescapedStringContent(std::string_view rawString) {
+    constexpr std::string_view rawStringDelimiter = "'''";
+    const size_t delimiterSize = rawStringDelimiter.size();
+    if (rawString.size() >= 2 * delimiterSize && rawString.substr(0, delimiterSize) == rawStringDelimiter && rawString.substr(rawString.size() - delimiterSize) == rawStringDelimiter) {
+        return rawString.substr(delimiterSize, rawString.size() - 2 * delimiterSize);
+    }
+    if (rawString.size() >= 2 && rawString.front() == '"' && rawString.back() == '"' && rawString.find('\\') == std::string_view::npos) {
+        return rawString.substr(1, rawString.size() - 2);
+    }
+    return {};
+}
+
+void CmagJsonParser::adoptRawPropertyValues(const CmagJsonStructureIndex &index, size_t targetStructuralIndex, CmagTarget &target) {
+    // Target was already parsed, so only its structure has to be walked. Properties of each config are sorted by name,
+    // just like in a DOM object. Each value is compared with its raw text before being replaced, which also takes care
+    // of duplicated keys.
+    std::vector<CmagJsonStructureIndex::Member> targetMembers = {};
+    std::vector<CmagJsonStructureIndex::Member> configMembers = {};
+    std::vector<CmagJsonStructureIndex::Member> propertyMembers = {};
+    if (!index.collectObjectMembers(targetStructuralIndex, targetMembers)) {
+        return;
+    }
+    for (const CmagJsonStructureIndex::Member &targetMember : targetMembers) {
+        if (targetMember.key != "\"configs\"" || !index.isObject(targetMember.valueStructuralIndex) || !index.collectObjectMembers(targetMember.valueStructuralIndex, configMembers)) {
+            continue;
+        }
+
+        for (const CmagJsonStructureIndex::Member &configMember : configMembers) {
+            const std::optional<std::string_view> configName = getUnescapedStringContent(configMember.key);
+            auto configIt = std::find_if(target.configs.begin(), target.configs.end(), [&](const CmagTargetConfig &config) {
+                return configName.has_value() && config.name == configName.value();
+            });
+            if (configIt == target.configs.end() || !index.isObject(configMember.valueStructuralIndex) || !index.collectObjectMembers(configMember.valueStructuralIndex, propertyMembers)) {
+                continue;
+            }
+
+            std::vector<CmagTargetProperty> &properties = configIt->properties;
+            for (const CmagJsonStructureIndex::Member &propertyMember : propertyMembers) {
+                const std::optional<std::string_view> propertyName = getUnescapedStringContent(propertyMember.key);
+                const std::optional<std::string_view> rawValue = getUnescapedStringContent(propertyMember.value);
+                if (!propertyName.has_value() || !rawValue.has_value()) {
+                    continue;
+                }
+                auto propertyIt = std::lower_bound(properties.begin(), properties.end(), propertyName.value(), [](const CmagTargetProperty &property, std::string_view name) {
+                    return property.name < name;
+                });
+                if (propertyIt != properties.end() && propertyIt->name == propertyName.value() && propertyIt->value == rawValue.value()) {
+                    propertyIt->value = rawValue.value();
+                }
+            }
+        }
+    }
+}
+
+ParseResult CmagJsonParser::validateVersion(const SaxGlobalsNode &globalsNode) {
     CmagVersion projectVersion = {};
-    RETURN_ERROR(parseObjectField(*globalsNodeIt, "cmagVersion", projectVersion));
+    RETURN_ERROR(parseObjectField(globalsNode.fields, "cmagVersion", projectVersion));
 
     if (!cmagVersion.isProjectCompatible(projectVersion)) {
         return {
@@ -168,12 +767,12 @@ ParseResult CmagJsonParser::validateVersion(const nlohmann::json &node) {
     return ParseResult::success;
 }
 
-ParseResult CmagJsonParser::parseGlobalValues(const nlohmann::json &node, CmagGlobals &outGlobals) {
-    if (!node.is_object()) {
+ParseResult CmagJsonParser::parseGlobalValues(const SaxGlobalsNode &node, CmagGlobals &outGlobals) {
+    if (!node.isObject) {
         return {ParseResultStatus::InvalidNodeType, "Globals node should be an object"};
     }
 
-#define PARSE_GLOBAL_FIELD(name) RETURN_ERROR(parseObjectField(node, #name, outGlobals.name))
+#define PARSE_GLOBAL_FIELD(name) RETURN_ERROR(parseObjectField(node.fields, #name, outGlobals.name))
     PARSE_GLOBAL_FIELD(darkMode);
 
     PARSE_GLOBAL_FIELD(selectedConfig);
@@ -190,14 +789,14 @@ ParseResult CmagJsonParser::parseGlobalValues(const nlohmann::json &node, CmagGl
     PARSE_GLOBAL_FIELD(cmagProjectName);
 #undef PARSE_GLOBAL_FIELD
 
-    if (auto browserNodeIt = node.find("browser"); browserNodeIt != node.end()) {
-        RETURN_ERROR(parseGlobalValuesBrowser(*browserNodeIt, outGlobals.browser));
+    if (node.browser.has_value()) {
+        RETURN_ERROR(parseGlobalValuesBrowser(node.browser.value(), outGlobals.browser));
     } else {
         return {ParseResultStatus::MissingField, "Missing browser node"};
     }
 
-    if (auto listDirsNodeIt = node.find("listDirs"); listDirsNodeIt != node.end()) {
-        RETURN_ERROR(parseGlobalValueListDirs(*listDirsNodeIt, outGlobals));
+    if (node.listDirs.has_value()) {
+        RETURN_ERROR(parseGlobalValueListDirs(node.listDirs.value(), outGlobals));
     } else {
         return {ParseResultStatus::MissingField, "Missing listDirs node"};
     }
@@ -205,12 +804,12 @@ ParseResult CmagJsonParser::parseGlobalValues(const nlohmann::json &node, CmagGl
     return ParseResult::success;
 }
 
-ParseResult CmagJsonParser::parseGlobalValuesBrowser(const nlohmann::json &node, CmagGlobals::BrowserData &outBrowser) {
-    if (!node.is_object()) {
+ParseResult CmagJsonParser::parseGlobalValuesBrowser(const SaxObjectNode &node, CmagGlobals::BrowserData &outBrowser) {
+    if (!node.isObject) {
         return {ParseResultStatus::InvalidNodeType, "List dirs node should be an object"};
     }
 
-#define PARSE_BROWSER_FIELD(name) RETURN_ERROR(parseObjectField(node, #name, outBrowser.name))
+#define PARSE_BROWSER_FIELD(name) RETURN_ERROR(parseObjectField(node.fields, #name, outBrowser.name))
     PARSE_BROWSER_FIELD(needsLayout);
     PARSE_BROWSER_FIELD(autoSaveEnabled);
     PARSE_BROWSER_FIELD(cameraX);
@@ -224,54 +823,52 @@ ParseResult CmagJsonParser::parseGlobalValuesBrowser(const nlohmann::json &node,
     return ParseResult::success;
 }
 
-ParseResult CmagJsonParser::parseGlobalValueListDirs(const nlohmann::json &node, CmagGlobals &outGlobals) {
-    if (!node.is_object()) {
+ParseResult CmagJsonParser::parseGlobalValueListDirs(const SaxListDirsNode &node, CmagGlobals &outGlobals) {
+    if (!node.isObject) {
         return {ParseResultStatus::InvalidNodeType, "List dirs node should be an object"};
     }
 
     // First pass - gather all files
-    for (auto listDirNodeIt = node.begin(); listDirNodeIt != node.end(); listDirNodeIt++) {
+    for (const auto &[listDirName, listDirNode] : node.listDirs) {
         CmagListDir listDir = {};
-        listDir.name = listDirNodeIt.key();
+        listDir.name = listDirName;
         outGlobals.listDirs.push_back(listDir);
     }
 
-    // Second pass - scan for children indices. This has quadratic complexity, but there usually aren't
-    // thousands of CMakeLists.txt files, so we should be good.
+    // Second pass - scan for children indices. Names are hashed, so big projects with thousands of CMakeLists.txt
+    // files don't suffer from quadratic lookups. If names repeat, the first one wins.
+    std::unordered_map<std::string_view, size_t> listDirIndicesByName = {};
+    listDirIndicesByName.reserve(outGlobals.listDirs.size());
+    for (size_t j = 0; j < outGlobals.listDirs.size(); j++) {
+        listDirIndicesByName.emplace(outGlobals.listDirs[j].name, j);
+    }
     size_t i = 0u;
-    for (auto listDirNodeIt = node.begin(); listDirNodeIt != node.end(); listDirNodeIt++, i++) {
+    for (auto listDirNodeIt = node.listDirs.begin(); listDirNodeIt != node.listDirs.end(); listDirNodeIt++, i++) {
         CmagListDir &listDir = outGlobals.listDirs[i];
 
-        nlohmann::json childrenNode = listDirNodeIt.value();
-        if (!childrenNode.is_array()) {
+        const SaxListDirsNode::ListDir &childrenNode = listDirNodeIt->second;
+        if (!childrenNode.isArray) {
             return {ParseResultStatus::InvalidNodeType, "List dir's subdirs node should be an array"};
         }
 
-        for (auto &childNodeIt : childrenNode) {
-            if (!childNodeIt.is_string()) {
+        for (const std::optional<std::string> &childNode : childrenNode.children) {
+            if (!childNode.has_value()) {
                 return {ParseResultStatus::InvalidNodeType, "List dir's subdir should be a string"};
             }
 
-            const std::string childName = childNodeIt.get<std::string>();
-            bool foundIndex = false;
-            for (size_t j = 0; j < outGlobals.listDirs.size(); j++) {
-                if (outGlobals.listDirs[j].name == childName) {
-                    listDir.childIndices.push_back(j);
-                    foundIndex = true;
-                    break;
-                }
-            }
-
-            if (!foundIndex) {
+            const std::string &childName = childNode.value();
+            auto childIt = listDirIndicesByName.find(childName);
+            if (childIt == listDirIndicesByName.end()) {
                 return {ParseResultStatus::MissingField, LOG_TO_STRING("Invalid list dir's subdir mentioned: ", childName)};
             }
+            listDir.childIndices.push_back(childIt->second);
         }
     }
 
     return ParseResult::success;
 }
 
-ParseResult CmagJsonParser::parseTargets(const nlohmann::json &node, std::vector<CmagTarget> &outTargets, bool isProjectFile) {
+ParseResult CmagJsonParser::parseTargets(const nlohmann::json &node, std::vector<CmagTarget> &outTargets, std::pmr::memory_resource *memoryResource, CmagGenexCache *genexCache) {
     if (!node.is_object()) {
         return {ParseResultStatus::InvalidNodeType, "Targets node should be an object"};
     }
@@ -283,14 +880,14 @@ ParseResult CmagJsonParser::parseTargets(const nlohmann::json &node, std::vector
             return {ParseResultStatus::InvalidValue, "Target name is empty"};
         }
 
-        RETURN_ERROR(parseTarget(*targetNodeIt, target, isProjectFile));
+        RETURN_ERROR(parseTarget(*targetNodeIt, target, memoryResource, genexCache));
         outTargets.push_back(std::move(target));
     }
 
     return ParseResult::success;
 }
 
-ParseResult CmagJsonParser::parseTarget(const nlohmann::json &node, CmagTarget &outTarget, bool isProjectFile) {
+ParseResult CmagJsonParser::parseTarget(const nlohmann::json &node, CmagTarget &outTarget, std::pmr::memory_resource *memoryResource, CmagGenexCache *genexCache) {
     FATAL_ERROR_IF(outTarget.name.empty(), "Parsing target with empty name");
 
     if (!node.is_object()) {
@@ -305,15 +902,13 @@ ParseResult CmagJsonParser::parseTarget(const nlohmann::json &node, CmagTarget &
     RETURN_ERROR(parseObjectField(node, "isImported", outTarget.isImported));
 
     if (auto configsNodeIt = node.find("configs"); configsNodeIt != node.end()) {
-        RETURN_ERROR(parseConfigs(*configsNodeIt, outTarget, isProjectFile));
+        RETURN_ERROR(parseConfigs(*configsNodeIt, outTarget, memoryResource, genexCache));
     } else {
         return {ParseResultStatus::MissingField, LOG_TO_STRING("Missing configs node for target ", outTarget.name)};
     }
 
     if (auto configsNodeIt = node.find("graphical"); configsNodeIt != node.end()) {
         RETURN_ERROR(parseTargetGraphical(*configsNodeIt, outTarget.graphical));
-    } else if (isProjectFile) {
-        return {ParseResultStatus::MissingField, LOG_TO_STRING("Missing target graphical node for target ", outTarget.name)};
     }
 
     if (auto aliasesNodeIt = node.find("aliases"); aliasesNodeIt != node.end()) {
@@ -327,7 +922,50 @@ ParseResult CmagJsonParser::parseTarget(const nlohmann::json &node, CmagTarget &
     return ParseResult::success;
 }
 
-ParseResult CmagJsonParser::parseConfigs(const nlohmann::json &node, CmagTarget &outTarget, bool isProjectFile) {
+ParseResult CmagJsonParser::parseTarget(SaxTargetNode &node, CmagTarget &outTarget) {
+    FATAL_ERROR_IF(outTarget.name.empty(), "Parsing target with empty name");
+
+    if (!node.isObject) {
+        return {ParseResultStatus::InvalidNodeType, "Target node should be an object"};
+    }
+
+    RETURN_ERROR(parseObjectField(node.fields, "type", outTarget.type));
+    if (outTarget.type == CmagTargetType::Invalid) {
+        return {ParseResultStatus::InvalidValue, LOG_TO_STRING("Invalid type specified for target ", outTarget.name)};
+    }
+
+    RETURN_ERROR(parseObjectField(node.fields, "isImported", outTarget.isImported));
+
+    if (node.hasConfigs) {
+        RETURN_ERROR(parseConfigs(node, outTarget));
+    } else {
+        return {ParseResultStatus::MissingField, LOG_TO_STRING("Missing configs node for target ", outTarget.name)};
+    }
+
+    if (node.graphical.has_value()) {
+        RETURN_ERROR(parseTargetGraphical(node.graphical.value(), outTarget.graphical));
+    } else {
+        return {ParseResultStatus::MissingField, LOG_TO_STRING("Missing target graphical node for target ", outTarget.name)};
+    }
+
+    if (node.hasAliases) {
+        if (!node.isAliasesArray) {
+            return {ParseResultStatus::InvalidNodeType, "Target aliases node should be an array"};
+        }
+        if (node.hasNonStringAlias) {
+            return {ParseResultStatus::InvalidNodeType, "Target alias should be a string value"};
+        }
+        outTarget.aliases = std::move(node.aliases);
+    } else {
+        return {ParseResultStatus::MissingField, LOG_TO_STRING("Missing aliases node for target ", outTarget.name)};
+    }
+
+    RETURN_ERROR(parseObjectField(node.fields, "listDir", outTarget.listDirName));
+
+    return ParseResult::success;
+}
+
+ParseResult CmagJsonParser::parseConfigs(const nlohmann::json &node, CmagTarget &outTarget, std::pmr::memory_resource *memoryResource, CmagGenexCache *genexCache) {
     if (!node.is_object()) {
         return {ParseResultStatus::InvalidNodeType, "Configs node should be an object"};
     }
@@ -338,55 +976,96 @@ ParseResult CmagJsonParser::parseConfigs(const nlohmann::json &node, CmagTarget
 
     for (auto configIt = node.begin(); configIt != node.end(); configIt++) {
         CmagTargetConfig &config = outTarget.getOrCreateConfig(configIt.key());
-        if (isProjectFile) {
-            RETURN_ERROR(parseConfigInProjectFile(*configIt, config));
-        } else {
-            RETURN_ERROR(parseConfigInTargetsFile(*configIt, config, outTarget.name.c_str()));
-        }
+        RETURN_ERROR(parseConfigInTargetsFile(*configIt, config, outTarget.name.c_str(), memoryResource, *genexCache));
     }
 
     return ParseResult::success;
 }
 
-ParseResult CmagJsonParser::parseConfigInProjectFile(const nlohmann::json &node, CmagTargetConfig &outConfig) {
-    if (!node.is_object()) {
-        return {ParseResultStatus::InvalidNodeType, "Config node should be an object"};
+// Sorts properties by their names, like in a DOM object. Duplicated names overwrite previous values.
+static void sortProperties(std::vector<CmagTargetProperty> &properties) {
+    auto compareNames = [](const CmagTargetProperty &left, const CmagTargetProperty &right) {
+        return left.name < right.name;
+    };
+    if (!std::is_sorted(properties.begin(), properties.end(), compareNames)) {
+        std::stable_sort(properties.begin(), properties.end(), compareNames);
     }
 
-    for (auto it = node.begin(); it != node.end(); it++) {
-        CmagTargetProperty property = {it.key(), it.value()};
-        outConfig.properties.push_back(std::move(property));
+    auto dstIt = properties.begin();
+    for (auto srcIt = properties.begin(); srcIt != properties.end(); srcIt++) {
+        auto nextIt = std::next(srcIt);
+        if (nextIt == properties.end() || nextIt->name != srcIt->name) {
+            *dstIt++ = *srcIt;
+        }
+    }
+    properties.erase(dstIt, properties.end());
+}
+
+ParseResult CmagJsonParser::parseConfigs(SaxTargetNode &node, CmagTarget &outTarget) {
+    if (!node.isConfigsObject) {
+        return {ParseResultStatus::InvalidNodeType, "Configs node should be an object"};
+    }
+
+    if (node.configs.empty()) {
+        return {ParseResultStatus::MissingField, LOG_TO_STRING("No configs specified for target ", outTarget.name)};
     }
+
+    std::sort(node.configs.begin(), node.configs.end(), [](const SaxTargetNode::Config &left, const SaxTargetNode::Config &right) {
+        return left.config.name < right.config.name;
+    });
+    outTarget.configs.reserve(node.configs.size());
+    for (SaxTargetNode::Config &config : node.configs) {
+        if (!config.isObject) {
+            return {ParseResultStatus::InvalidNodeType, "Config node should be an object"};
+        }
+
+        // Values of properties have to be strings. The first invalid one in order of names is accessed just like in
+        // the DOM parser, so it fails in the same way, unless it was overwritten by a duplicated key.
+        std::vector<CmagTargetProperty> &properties = config.config.properties;
+        const nlohmann::json *invalidValue = nullptr;
+        std::string_view invalidValueName = {};
+        for (const auto &[propertyIndex, value] : config.nonStringValues) {
+            const std::string_view propertyName = properties[propertyIndex].name;
+            const bool isOverwritten = std::any_of(properties.begin() + propertyIndex + 1, properties.end(), [&](const CmagTargetProperty &property) {
+                return property.name == propertyName;
+            });
+            if (!isOverwritten && (invalidValue == nullptr || propertyName < invalidValueName)) {
+                invalidValue = &value;
+                invalidValueName = propertyName;
+            }
+        }
+        if (invalidValue != nullptr) {
+            static_cast<void>(invalidValue->get_ref<const std::string &>());
+        }
+
+        sortProperties(properties);
+        outTarget.configs.push_back(std::move(config.config));
+    }
+
     return ParseResult::success;
 }
 
-ParseResult CmagJsonParser::parseConfigInTargetsFile(const nlohmann::json &node, CmagTargetConfig &outConfig, const char *targetName) {
+ParseResult CmagJsonParser::parseConfigInTargetsFile(const nlohmann::json &node, CmagTargetConfig &outConfig, const char *targetName, std::pmr::memory_resource *memoryResource, CmagGenexCache &genexCache) {
     if (!node.is_object()) {
         return {ParseResultStatus::InvalidNodeType, "Config node should be an object"};
     }
 
     if (auto propertiesNodeIt = node.find("non_genexable"); propertiesNodeIt != node.end()) {
-        for (auto it = propertiesNodeIt->begin(); it != propertiesNodeIt->end(); it++) {
-            CmagTargetProperty property = {it.key(), it.value()};
-            outConfig.properties.push_back(std::move(property));
-        }
+        RETURN_ERROR(parseProperties(*propertiesNodeIt, outConfig, memoryResource));
     } else {
         return {ParseResultStatus::MissingField, LOG_TO_STRING("Missing non_genexable field for ", targetName)};
     }
 
     if (auto propertiesNodeIt = node.find("genexable_evaled"); propertiesNodeIt != node.end()) {
-        for (auto it = propertiesNodeIt->begin(); it != propertiesNodeIt->end(); it++) {
-            CmagTargetProperty property = {it.key(), it.value()};
-            outConfig.properties.push_back(std::move(property));
-        }
+        RETURN_ERROR(parseProperties(*propertiesNodeIt, outConfig, memoryResource));
     } else {
         return {ParseResultStatus::MissingField, LOG_TO_STRING("Missing genexable_evaled field for ", targetName)};
     }
 
     if (auto propertiesNodeIt = node.find("genexable"); propertiesNodeIt != node.end()) {
         for (auto it = propertiesNodeIt->begin(); it != propertiesNodeIt->end(); it++) {
-            std::string propertyValue = it.value();
-            outConfig.fixupWithNonEvaled(it.key(), propertyValue);
+            const std::string &propertyValue = it.value().get_ref<const std::string &>();
+            outConfig.fixupWithNonEvaled(it.key(), propertyValue, memoryResource, genexCache);
         }
     } else {
         return {ParseResultStatus::MissingField, LOG_TO_STRING("Missing genexable field for ", targetName)};
@@ -395,6 +1074,18 @@ ParseResult CmagJsonParser::parseConfigInTargetsFile(const nlohmann::json &node,
     return ParseResult::success;
 }
 
+ParseResult CmagJsonParser::parseProperties(const nlohmann::json &node, CmagTargetConfig &outConfig, std::pmr::memory_resource *memoryResource) {
+    outConfig.properties.reserve(outConfig.properties.size() + node.size());
+    for (auto it = node.begin(); it != node.end(); it++) {
+        const std::string &value = it.value().get_ref<const std::string &>();
+        outConfig.properties.push_back(CmagTargetProperty{
+            storeString(it.key(), memoryResource),
+            storeString(value, memoryResource),
+        });
+    }
+    return ParseResult::success;
+}
+
 ParseResult CmagJsonParser::parseTargetGraphical(const nlohmann::json &node, CmagTargetGraphicalData &outGraphical) {
     if (!node.is_object()) {
         return {ParseResultStatus::InvalidNodeType, "Target graphical node should be an object"};
@@ -406,6 +1097,18 @@ ParseResult CmagJsonParser::parseTargetGraphical(const nlohmann::json &node, Cma
 
     return ParseResult::success;
 }
+ParseResult CmagJsonParser::parseTargetGraphical(const SaxObjectNode &node, CmagTargetGraphicalData &outGraphical) {
+    if (!node.isObject) {
+        return {ParseResultStatus::InvalidNodeType, "Target graphical node should be an object"};
+    }
+
+    RETURN_ERROR(parseObjectField(node.fields, "x", outGraphical.x));
+    RETURN_ERROR(parseObjectField(node.fields, "y", outGraphical.y));
+    RETURN_ERROR(parseObjectField(node.fields, "hideConnections", outGraphical.hideConnections));
+
+    return ParseResult::success;
+}
+
 ParseResult CmagJsonParser::parseTargetAliases(const nlohmann::json &node, CmagTarget &outTarget) {
     if (!node.is_array()) {
         return {ParseResultStatus::InvalidNodeType, "Target aliases node should be an array"};
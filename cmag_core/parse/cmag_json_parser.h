@@ -1,57 +1,75 @@
 #pragma once
 
 #include "cmag_core/core/cmag_project.h"
+#include "cmag_core/parse/json_structure_index.h"
+#include "cmag_core/parse/parse_result.h"
 #include "cmag_core/utils/filesystem.h"
 
+#include <map>
+#include <memory>
+#include <memory_resource>
 #include <nlohmann/json.hpp>
 #include <string>
 
-enum class ParseResultStatus {
-    Success,
-    Malformed,
-    InvalidNodeType,
-    InvalidValue,
-    MissingField,
-    DataDerivationFailed,
-    VersionMismatch,
-};
-
-struct ParseResult {
-    ParseResult(ParseResultStatus status, const std::string &errorMessage);
-
-    ParseResultStatus status = ParseResultStatus::Success;
-    std::string errorMessage = {};
-
-    const static ParseResult success;
-};
-
 class CmagJsonParser {
 public:
-    static ParseResult parseProject(std::string_view json, CmagProject &outProject);
+    // In lazy mode the json is stored in the project as a whole and values of properties are views into it, as long as
+    // they're not escaped. Only well-formed files parsed concurrently can be loaded lazily, others are loaded eagerly.
+    static ParseResult parseProject(std::string_view json, CmagProject &outProject, bool lazyPropertyValues = false);
 
     static ParseResult parseTargetsFilesListFile(std::string_view json, std::vector<std::string> &outFileNames);
     static ParseResult parseGlobalsFile(std::string_view json, CmagGlobals &outGlobals);
-    static ParseResult parseTargetsFile(std::string_view json, std::vector<CmagTarget> &outTargets);
+    // Big targets files are parsed on multiple threads. Callers already parsing multiple files concurrently should
+    // disable it, to not spawn threads on each of their threads. Strings of the properties are stored in the memory
+    // resource, which has to be valid until the targets are added to a project.
+    static ParseResult parseTargetsFile(std::string_view json, std::vector<CmagTarget> &outTargets, std::pmr::memory_resource *memoryResource, bool multithreaded = true);
     static ParseResult parseAliasesFile(std::string_view json, std::vector<std::pair<std::string, std::string>> &outAliases);
 
 private:
-    static ParseResult validateVersion(const nlohmann::json &node);
+    class ProjectSaxHandler;
+    struct SaxObjectNode;
+    struct SaxListDirsNode;
+    struct SaxGlobalsNode;
+    struct SaxTargetNode;
+    struct ParsedTarget;
+    struct ParsedProject;
 
-    static ParseResult parseGlobalValues(const nlohmann::json &node, CmagGlobals &outGlobals);
-    static ParseResult parseGlobalValuesBrowser(const nlohmann::json &node, CmagGlobals::BrowserData &outBrowser);
-    static ParseResult parseGlobalValueListDirs(const nlohmann::json &node, CmagGlobals &outGlobals);
+    // Scalar fields of a node parsed by the SAX handler, keyed by their names.
+    using SaxFields = std::map<std::string, nlohmann::json, std::less<>>;
 
-    static ParseResult parseTargets(const nlohmann::json &node, std::vector<CmagTarget> &outTargets, bool isProjectFile);
-    static ParseResult parseTarget(const nlohmann::json &node, CmagTarget &outTarget, bool isProjectFile);
+    static bool parseProjectConcurrently(std::string_view json, bool lazyPropertyValues, ParsedProject &outParsedProject);
+    static bool parseTargetsConcurrently(const std::vector<CmagJsonStructureIndex::Member> &members,
+                                         bool isProjectFile,
+                                         bool multithreaded,
+                                         const CmagJsonStructureIndex *rawValuesIndex,
+                                         std::vector<std::unique_ptr<std::pmr::monotonic_buffer_resource>> &outMemoryResources,
+                                         std::map<std::string, ParsedTarget> &outTargets);
+    static void adoptRawPropertyValues(const CmagJsonStructureIndex &index, size_t targetStructuralIndex, CmagTarget &target);
 
-    static ParseResult parseConfigs(const nlohmann::json &node, CmagTarget &outTarget, bool isProjectFile);
-    static ParseResult parseConfigInProjectFile(const nlohmann::json &node, CmagTargetConfig &outConfig);
-    static ParseResult parseConfigInTargetsFile(const nlohmann::json &node, CmagTargetConfig &outConfig, const char *targetName);
+    static ParseResult validateVersion(const SaxGlobalsNode &globalsNode);
+
+    static ParseResult parseGlobalValues(const SaxGlobalsNode &node, CmagGlobals &outGlobals);
+    static ParseResult parseGlobalValuesBrowser(const SaxObjectNode &node, CmagGlobals::BrowserData &outBrowser);
+    static ParseResult parseGlobalValueListDirs(const SaxListDirsNode &node, CmagGlobals &outGlobals);
+
+    static ParseResult parseTargets(const nlohmann::json &node, std::vector<CmagTarget> &outTargets, std::pmr::memory_resource *memoryResource, CmagGenexCache *genexCache);
+    static ParseResult parseTarget(const nlohmann::json &node, CmagTarget &outTarget, std::pmr::memory_resource *memoryResource, CmagGenexCache *genexCache);
+    static ParseResult parseTarget(SaxTargetNode &node, CmagTarget &outTarget);
+
+    static ParseResult parseConfigs(const nlohmann::json &node, CmagTarget &outTarget, std::pmr::memory_resource *memoryResource, CmagGenexCache *genexCache);
+    static ParseResult parseConfigs(SaxTargetNode &node, CmagTarget &outTarget);
+    static ParseResult parseConfigInTargetsFile(const nlohmann::json &node, CmagTargetConfig &outConfig, const char *targetName, std::pmr::memory_resource *memoryResource, CmagGenexCache &genexCache);
+    static ParseResult parseProperties(const nlohmann::json &node, CmagTargetConfig &outConfig, std::pmr::memory_resource *memoryResource);
 
     static ParseResult parseTargetGraphical(const nlohmann::json &node, CmagTargetGraphicalData &outGraphical);
+    static ParseResult parseTargetGraphical(const SaxObjectNode &node, CmagTargetGraphicalData &outGraphical);
 
     static ParseResult parseTargetAliases(const nlohmann::json &node, CmagTarget &outTarget);
 
     template <typename DstT>
     static ParseResult parseObjectField(const nlohmann::json &node, const char *name, DstT &dst);
+    template <typename DstT>
+    static ParseResult parseObjectField(const SaxFields &fields, const char *name, DstT &dst);
+    template <typename DstT>
+    static ParseResult parseFieldValue(const nlohmann::json *valueNode, const char *name, DstT &dst);
 };
@@ -1,116 +1,342 @@
 #include "cmag_json_writer.h"
 
 #include "cmag_core/parse/enum_serialization.h"
+#include "cmag_core/utils/error.h"
 
-#include <iomanip>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
 
-void CmagJsonWriter::writeProject(const CmagProject &project, std::ostream &out) {
-    nlohmann::json node = nlohmann::json::object();
-    node["globals"] = createGlobalsNode(project.getGlobals());
-    node["targets"] = createTargetsNode(project.getTargets());
-    out << std::setw(4) << node;
+class CmagJsonWriter::Output {
+public:
+    Output(std::ostream &out, bool compact) : out(out), compact(compact) {
+        buffer.reserve(flushThreshold + 4096);
+    }
+    ~Output() {
+        flush();
+    }
+
+    void beginObject() {
+        beginValue();
+        buffer.push_back('{');
+        scopesEmpty.push_back(true);
+    }
+    void endObject() {
+        endScope();
+        buffer.push_back('}');
+    }
+    void beginArray() {
+        beginValue();
+        buffer.push_back('[');
+        scopesEmpty.push_back(true);
+    }
+    void endArray() {
+        endScope();
+        buffer.push_back(']');
+    }
+
+    void writeKey(std::string_view key) {
+        beginScopeElement();
+        writeEscaped(key);
+        buffer.append(compact ? ":" : ": ");
+        afterKey = true;
+    }
+    void writeString(std::string_view value) {
+        beginValue();
+        writeEscaped(value);
+    }
+    void writeBool(bool value) {
+        beginValue();
+        buffer.append(value ? "true" : "false");
+    }
+    void writeInt(int64_t value) {
+        beginValue();
+        char chars[32];
+        const auto result = std::to_chars(chars, chars + sizeof(chars), value);
+        buffer.append(chars, static_cast<size_t>(result.ptr - chars));
+    }
+    void writeFloat(double value) {
+        beginValue();
+        if (!std::isfinite(value)) {
+            buffer.append("null");
+            return;
+        }
+        // Use the same algorithm as nlohmann::json to get exactly the same shortest round-trip representation.
+        char chars[64];
+        char *end = nlohmann::detail::to_chars(chars, chars + sizeof(chars), value);
+        buffer.append(chars, static_cast<size_t>(end - chars));
+    }
+
+    void flush() {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+
+private:
+    void beginValue() {
+        if (afterKey) {
+            afterKey = false;
+        } else if (!scopesEmpty.empty()) {
+            beginScopeElement(); // array element
+        }
+    }
+    void beginScopeElement() {
+        if (!scopesEmpty.back()) {
+            buffer.push_back(',');
+        }
+        scopesEmpty.back() = false;
+        writeNewLine(scopesEmpty.size());
+    }
+    void endScope() {
+        const bool isEmpty = scopesEmpty.back();
+        scopesEmpty.pop_back();
+        if (!isEmpty) {
+            writeNewLine(scopesEmpty.size());
+        }
+        if (buffer.size() >= flushThreshold) {
+            flush();
+        }
+    }
+    void writeNewLine(size_t depth) {
+        if (!compact) {
+            buffer.push_back('\n');
+            buffer.append(depth * indentSize, ' ');
+        }
+    }
+    void writeEscaped(std::string_view value) {
+        buffer.push_back('"');
+        for (const char c : value) {
+            switch (c) {
+            case '"':
+                buffer.append("\\\"");
+                break;
+            case '\\':
+                buffer.append("\\\\");
+                break;
+            case '\b':
+                buffer.append("\\b");
+                break;
+            case '\f':
+                buffer.append("\\f");
+                break;
+            case '\n':
+                buffer.append("\\n");
+                break;
+            case '\r':
+                buffer.append("\\r");
+                break;
+            case '\t':
+                buffer.append("\\t");
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    const char *hexDigits = "0123456789abcdef";
+                    const char escaped[] = {'\\', 'u', '0', '0', hexDigits[c >> 4], hexDigits[c & 0xF]};
+                    buffer.append(escaped, sizeof(escaped));
+                } else {
+                    buffer.push_back(c);
+                }
+                break;
+            }
+        }
+        buffer.push_back('"');
+    }
+
+    constexpr static inline size_t flushThreshold = 64 * 1024;
+    constexpr static inline size_t indentSize = 4;
+
+    std::ostream &out;
+    const bool compact;
+    std::string buffer = {};
+    std::vector<bool> scopesEmpty = {};
+    bool afterKey = false;
+};
+
+void CmagJsonWriter::writeProject(const CmagProject &project, std::ostream &out, bool compact) {
+    writeProject(project, project.createBrowserStateSnapshot(), out, compact);
 }
 
-nlohmann::json CmagJsonWriter::createGlobalsNode(const CmagGlobals &globals) {
-    nlohmann::json node = nlohmann::json::object();
-#define WRITE_GLOBAL_FIELD(name) node[#name] = globals.name
-    WRITE_GLOBAL_FIELD(darkMode);
-    WRITE_GLOBAL_FIELD(selectedConfig);
-    node["cmagVersion"] = globals.cmagVersion.toString();
-    WRITE_GLOBAL_FIELD(cmakeVersion);
-    WRITE_GLOBAL_FIELD(cmakeProjectName);
-    WRITE_GLOBAL_FIELD(useFolders);
-    WRITE_GLOBAL_FIELD(sourceDir);
+void CmagJsonWriter::writeProject(const CmagProject &project, const CmagBrowserStateSnapshot &state, std::ostream &out, bool compact) {
+    FATAL_ERROR_IF(state.targetsGraphical.size() != project.getTargets().size(), "Browser state snapshot does not match the project");
+
+    Output output{out, compact};
+    output.beginObject();
+    output.writeKey("globals");
+    writeGlobals(output, project.getGlobals(), state);
+    output.writeKey("targets");
+    writeTargets(output, project.getTargets(), state);
+    output.endObject();
+}
+
+// Fields of all objects are written in alphabetical order.
+void CmagJsonWriter::writeGlobals(Output &out, const CmagGlobals &globals, const CmagBrowserStateSnapshot &state) {
+    out.beginObject();
+#define WRITE_GLOBAL_FIELD(name)  \
+    out.writeKey(#name);          \
+    out.writeString(globals.name)
+    out.writeKey("browser");
+    writeGlobalValueBrowser(out, state.browser);
     WRITE_GLOBAL_FIELD(buildDir);
-    WRITE_GLOBAL_FIELD(generator);
+    WRITE_GLOBAL_FIELD(cmagProjectName);
+    out.writeKey("cmagVersion");
+    out.writeString(globals.cmagVersion.toString());
+    WRITE_GLOBAL_FIELD(cmakeProjectName);
+    WRITE_GLOBAL_FIELD(cmakeVersion);
     WRITE_GLOBAL_FIELD(compilerId);
     WRITE_GLOBAL_FIELD(compilerVersion);
+    out.writeKey("darkMode");
+    out.writeBool(state.darkMode);
+    WRITE_GLOBAL_FIELD(generator);
+    out.writeKey("listDirs");
+    writeGlobalValueListDirs(out, globals);
     WRITE_GLOBAL_FIELD(os);
-    WRITE_GLOBAL_FIELD(cmagProjectName);
+    out.writeKey("selectedConfig");
+    out.writeString(state.selectedConfig);
+    WRITE_GLOBAL_FIELD(sourceDir);
+    WRITE_GLOBAL_FIELD(useFolders);
 #undef WRITE_GLOBAL_FIELD
-    node["browser"] = createGlobalValueBrowser(globals.browser);
-    node["listDirs"] = createGlobalValueListDirs(globals);
-    return node;
+    out.endObject();
 }
 
-nlohmann::json CmagJsonWriter::createGlobalValueBrowser(const CmagGlobals::BrowserData &browser) {
-    nlohmann::json node = nlohmann::json::object();
-#define WRITE_BROWSER_FIELD(name) node[#name] = browser.name
-    WRITE_BROWSER_FIELD(needsLayout);
-    WRITE_BROWSER_FIELD(autoSaveEnabled);
-    WRITE_BROWSER_FIELD(cameraX);
-    WRITE_BROWSER_FIELD(cameraY);
-    WRITE_BROWSER_FIELD(cameraScale);
-    WRITE_BROWSER_FIELD(displayedDependencyType);
-    WRITE_BROWSER_FIELD(selectedTabIndex);
-    WRITE_BROWSER_FIELD(selectedTargetName);
-#undef WRITE_BROWSER_FIELD
-    return node;
+void CmagJsonWriter::writeGlobalValueBrowser(Output &out, const CmagGlobals::BrowserData &browser) {
+    out.beginObject();
+    out.writeKey("autoSaveEnabled");
+    out.writeBool(browser.autoSaveEnabled);
+    out.writeKey("cameraScale");
+    out.writeFloat(browser.cameraScale);
+    out.writeKey("cameraX");
+    out.writeFloat(browser.cameraX);
+    out.writeKey("cameraY");
+    out.writeFloat(browser.cameraY);
+    out.writeKey("displayedDependencyType");
+    out.writeInt(static_cast<int64_t>(browser.displayedDependencyType));
+    out.writeKey("needsLayout");
+    out.writeBool(browser.needsLayout);
+    out.writeKey("selectedTabIndex");
+    out.writeInt(browser.selectedTabIndex);
+    out.writeKey("selectedTargetName");
+    out.writeString(browser.selectedTargetName);
+    out.endObject();
 }
 
-nlohmann::json CmagJsonWriter::createGlobalValueListDirs(const CmagGlobals &globals) {
-    nlohmann::json node = nlohmann::json::object();
-    for (const CmagListDir &listDir : globals.listDirs) {
-        node[listDir.name] = createListDirsNode(listDir, globals);
-    }
-    return node;
+void CmagJsonWriter::writeGlobalValueListDirs(Output &out, const CmagGlobals &globals) {
+    out.beginObject();
+    auto getKey = [](const CmagListDir &listDir) { return std::string_view{listDir.name}; };
+    forEachSortedByKey(globals.listDirs, getKey, [&](const CmagListDir &listDir) {
+        out.writeKey(listDir.name);
+        writeListDir(out, listDir, globals);
+    });
+    out.endObject();
 }
 
-nlohmann::json CmagJsonWriter::createListDirsNode(const CmagListDir &listDir, const CmagGlobals &globals) {
-    nlohmann::json node = nlohmann::json::array();
+void CmagJsonWriter::writeListDir(Output &out, const CmagListDir &listDir, const CmagGlobals &globals) {
+    out.beginArray();
     for (const size_t childIndex : listDir.childIndices) {
-        const std::string &childName = globals.listDirs[childIndex].name;
-        node.push_back(childName);
+        out.writeString(globals.listDirs[childIndex].name);
     }
-    return node;
+    out.endArray();
 }
 
-nlohmann::json CmagJsonWriter::createTargetsNode(const std::vector<CmagTarget> &targets) {
-    nlohmann::json node = nlohmann::json::object();
-    for (const CmagTarget &target : targets) {
-        node[target.name] = createTargetNode(target);
-    }
-    return node;
+void CmagJsonWriter::writeTargets(Output &out, const std::vector<CmagTarget> &targets, const CmagBrowserStateSnapshot &state) {
+    out.beginObject();
+    auto getKey = [](const CmagTarget &target) { return std::string_view{target.name}; };
+    forEachSortedByKey(targets, getKey, [&](const CmagTarget &target) {
+        const size_t targetIndex = static_cast<size_t>(&target - targets.data());
+        out.writeKey(target.name);
+        writeTarget(out, target, state.targetsGraphical[targetIndex]);
+    });
+    out.endObject();
 }
 
-nlohmann::json CmagJsonWriter::createTargetNode(const CmagTarget &target) {
-    nlohmann::json node = nlohmann::json::object();
-    node["type"] = target.type;
-    node["configs"] = createConfigsNode(target.configs);
-    node["graphical"] = createTargetGraphicalNode(target.graphical);
-    node["listDir"] = target.listDirName;
-    node["isImported"] = target.isImported;
-    node["aliases"] = createAliasesNode(target.aliases);
-    return node;
+void CmagJsonWriter::writeTarget(Output &out, const CmagTarget &target, const CmagTargetGraphicalData &graphicalData) {
+    // Target types are serialized with the same names as nlohmann::json would use
+    static const std::array<std::string, static_cast<size_t>(CmagTargetType::COUNT)> typeNames = []() {
+        std::array<std::string, static_cast<size_t>(CmagTargetType::COUNT)> result = {};
+        for (size_t typeIndex = 0; typeIndex < result.size(); typeIndex++) {
+            result[typeIndex] = nlohmann::json(static_cast<CmagTargetType>(typeIndex)).get<std::string>();
+        }
+        return result;
+    }();
+
+    out.beginObject();
+    out.writeKey("aliases");
+    writeAliases(out, target.aliases);
+    out.writeKey("configs");
+    writeConfigs(out, target.configs);
+    out.writeKey("graphical");
+    writeTargetGraphical(out, graphicalData);
+    out.writeKey("isImported");
+    out.writeBool(target.isImported);
+    out.writeKey("listDir");
+    out.writeString(target.listDirName);
+    out.writeKey("type");
+    out.writeString(typeNames[static_cast<size_t>(target.type)]);
+    out.endObject();
 }
 
-nlohmann::json CmagJsonWriter::createTargetGraphicalNode(const CmagTargetGraphicalData &graphicalData) {
-    nlohmann::json node = nlohmann::json::object();
-    node["x"] = graphicalData.x;
-    node["y"] = graphicalData.y;
-    node["hideConnections"] = graphicalData.hideConnections;
-    return node;
+void CmagJsonWriter::writeTargetGraphical(Output &out, const CmagTargetGraphicalData &graphicalData) {
+    out.beginObject();
+    out.writeKey("hideConnections");
+    out.writeBool(graphicalData.hideConnections);
+    out.writeKey("x");
+    out.writeFloat(graphicalData.x);
+    out.writeKey("y");
+    out.writeFloat(graphicalData.y);
+    out.endObject();
 }
 
-nlohmann::json CmagJsonWriter::createConfigsNode(const std::vector<CmagTargetConfig> &configs) {
-    nlohmann::json node = nlohmann::json::object();
-    for (const CmagTargetConfig &config : configs) {
-        node[config.name] = createConfigNode(config);
-    }
-    return node;
+void CmagJsonWriter::writeConfigs(Output &out, const std::vector<CmagTargetConfig> &configs) {
+    out.beginObject();
+    auto getKey = [](const CmagTargetConfig &config) { return std::string_view{config.name}; };
+    forEachSortedByKey(configs, getKey, [&](const CmagTargetConfig &config) {
+        out.writeKey(config.name);
+        writeConfig(out, config);
+    });
+    out.endObject();
 }
 
-nlohmann::json CmagJsonWriter::createConfigNode(const CmagTargetConfig &config) {
-    nlohmann::json node = nlohmann::json::object();
-    for (const CmagTargetProperty &property : config.properties) {
-        node[property.name] = property.value;
-    }
-    return node;
+void CmagJsonWriter::writeConfig(Output &out, const CmagTargetConfig &config) {
+    out.beginObject();
+    auto getKey = [](const CmagTargetProperty &property) { return std::string_view{property.name}; };
+    forEachSortedByKey(config.properties, getKey, [&](const CmagTargetProperty &property) {
+        out.writeKey(property.name);
+        out.writeString(property.getValue());
+    });
+    out.endObject();
 }
-nlohmann::json CmagJsonWriter::createAliasesNode(const std::vector<std::string> &aliases) {
-    nlohmann::json node = nlohmann::json::array();
+
+void CmagJsonWriter::writeAliases(Output &out, const std::vector<std::string> &aliases) {
+    out.beginArray();
     for (const std::string &alias : aliases) {
-        node.push_back(alias);
+        out.writeString(alias);
+    }
+    out.endArray();
+}
+
+template <typename T, typename GetKeyT, typename CallbackT>
+void CmagJsonWriter::forEachSortedByKey(const std::vector<T> &items, GetKeyT getKey, CallbackT callback) {
+    // Data loaded from json is already sorted, so usually we can avoid sorting.
+    auto isKeyGreaterOrEqual = [&](const T &left, const T &right) { return getKey(left) >= getKey(right); };
+    if (std::adjacent_find(items.begin(), items.end(), isKeyGreaterOrEqual) == items.end()) {
+        for (const T &item : items) {
+            callback(item);
+        }
+        return;
+    }
+
+    std::vector<const T *> sortedItems = {};
+    sortedItems.reserve(items.size());
+    for (const T &item : items) {
+        sortedItems.push_back(&item);
+    }
+    std::stable_sort(sortedItems.begin(), sortedItems.end(), [&](const T *left, const T *right) { return getKey(*left) < getKey(*right); });
+
+    // Json objects cannot have duplicated keys. Assigning the same key multiple times would leave the last value.
+    for (size_t i = 0; i < sortedItems.size(); i++) {
+        const bool isOverwritten = i + 1 < sortedItems.size() && getKey(*sortedItems[i]) == getKey(*sortedItems[i + 1]);
+        if (!isOverwritten) {
+            callback(*sortedItems[i]);
+        }
     }
-    return node;
 }
@@ -2,24 +2,35 @@
 
 #include "cmag_core/core/cmag_project.h"
 
-#include <nlohmann/json.hpp>
-#include <optional>
 #include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
 
+// Serializes the project directly to the output stream, without building a json DOM in memory. The output is the
+// same as if the project was put into nlohmann::json and dumped, so keys of all objects are sorted. The default
+// style is identical to dumping with 4 spaces of indentation. Compact style has no whitespace at all. Data modified by
+// the browser can be taken from a snapshot instead of the project, which allows writing on a separate thread.
 class CmagJsonWriter {
 public:
-    static void writeProject(const CmagProject &project, std::ostream &out);
+    static void writeProject(const CmagProject &project, std::ostream &out, bool compact = false);
+    static void writeProject(const CmagProject &project, const CmagBrowserStateSnapshot &state, std::ostream &out, bool compact = false);
 
 private:
-    static nlohmann::json createGlobalsNode(const CmagGlobals &globals);
-    static nlohmann::json createGlobalValueBrowser(const CmagGlobals::BrowserData &browser);
-    static nlohmann::json createGlobalValueListDirs(const CmagGlobals &globals);
-    static nlohmann::json createListDirsNode(const CmagListDir &listDir, const CmagGlobals &globals);
+    class Output;
 
-    static nlohmann::json createTargetsNode(const std::vector<CmagTarget> &targets);
-    static nlohmann::json createTargetNode(const CmagTarget &target);
-    static nlohmann::json createTargetGraphicalNode(const CmagTargetGraphicalData &graphicalData);
-    static nlohmann::json createConfigsNode(const std::vector<CmagTargetConfig> &configs);
-    static nlohmann::json createConfigNode(const CmagTargetConfig &config);
-    static nlohmann::json createAliasesNode(const std::vector<std::string> &aliases);
+    static void writeGlobals(Output &out, const CmagGlobals &globals, const CmagBrowserStateSnapshot &state);
+    static void writeGlobalValueBrowser(Output &out, const CmagGlobals::BrowserData &browser);
+    static void writeGlobalValueListDirs(Output &out, const CmagGlobals &globals);
+    static void writeListDir(Output &out, const CmagListDir &listDir, const CmagGlobals &globals);
+
+    static void writeTargets(Output &out, const std::vector<CmagTarget> &targets, const CmagBrowserStateSnapshot &state);
+    static void writeTarget(Output &out, const CmagTarget &target, const CmagTargetGraphicalData &graphicalData);
+    static void writeTargetGraphical(Output &out, const CmagTargetGraphicalData &graphicalData);
+    static void writeConfigs(Output &out, const std::vector<CmagTargetConfig> &configs);
+    static void writeConfig(Output &out, const CmagTargetConfig &config);
+    static void writeAliases(Output &out, const std::vector<std::string> &aliases);
+
+    template <typename T, typename GetKeyT, typename CallbackT>
+    static void forEachSortedByKey(const std::vector<T> &items, GetKeyT getKey, CallbackT callback);
 };
@@ -0,0 +1,104 @@
+#include "cmag_project_file.h"
+
+#include "cmag_core/parse/cmag_binary_parser.h"
+#include "cmag_core/parse/cmag_binary_writer.h"
+#include "cmag_core/parse/cmag_json_parser.h"
+#include "cmag_core/parse/cmag_json_writer.h"
+#include "cmag_core/utils/error.h"
+#include "cmag_core/utils/file_utils.h"
+
+CmagProjectFormat CmagProjectFile::detectFormat(std::string_view content) {
+    if (CmagBinaryProjectView::hasMagic(content)) {
+        return CmagProjectFormat::Binary;
+    }
+    return CmagProjectFormat::Json;
+}
+
+CmagProjectFormat CmagProjectFile::getOtherFormat(CmagProjectFormat format) {
+    switch (format) {
+    case CmagProjectFormat::Json:
+        return CmagProjectFormat::Binary;
+    case CmagProjectFormat::Binary:
+        return CmagProjectFormat::Json;
+    default:
+        UNREACHABLE_CODE;
+    }
+}
+
+const char *CmagProjectFile::getExtension(CmagProjectFormat format) {
+    switch (format) {
+    case CmagProjectFormat::Json:
+        return ".cmag-project";
+    case CmagProjectFormat::Binary:
+        return ".cmag-project-bin";
+    default:
+        UNREACHABLE_CODE;
+    }
+}
+
+fs::path CmagProjectFile::getPathForFormat(const fs::path &path, CmagProjectFormat format) {
+    fs::path result = path;
+    const fs::path extension = path.extension();
+    if (extension == getExtension(CmagProjectFormat::Json) || extension == getExtension(CmagProjectFormat::Binary)) {
+        result.replace_extension(getExtension(format));
+    } else {
+        result += getExtension(format);
+    }
+    return result;
+}
+
+std::ios::openmode CmagProjectFile::getOpenMode(CmagProjectFormat format) {
+    switch (format) {
+    case CmagProjectFormat::Json:
+        return std::ios::out;
+    case CmagProjectFormat::Binary:
+        return std::ios::out | std::ios::binary;
+    default:
+        UNREACHABLE_CODE;
+    }
+}
+
+ParseResult CmagProjectFile::parseProject(std::string_view content, CmagProject &outProject, CmagProjectFormat *outFormat, bool lazyPropertyValues) {
+    const CmagProjectFormat format = detectFormat(content);
+    if (outFormat) {
+        *outFormat = format;
+    }
+
+    switch (format) {
+    case CmagProjectFormat::Json:
+        return CmagJsonParser::parseProject(content, outProject, lazyPropertyValues);
+    case CmagProjectFormat::Binary:
+        return CmagBinaryParser::parseProject(content, outProject, lazyPropertyValues);
+    default:
+        UNREACHABLE_CODE;
+    }
+}
+
+ParseResult CmagProjectFile::readProject(const fs::path &path, CmagProject &outProject, CmagProjectFormat *outFormat, bool lazyPropertyValues) {
+    // The file is viewed only for the time of parsing. The project must not point into the mapping, because the file is
+    // replaced while the project is alive: the browser saves over the same path, which fails on Windows if the file
+    // is still mapped, and cmag may truncate and regenerate it, which makes accessing a live mapping crash on Linux.
+    // Hence the data of lazily loaded properties is copied as a whole and other strings are copied as well.
+    FileView file = {};
+    if (!file.open(path)) {
+        return {ParseResultStatus::FileAccessError, "Could not read project file"};
+    }
+    return parseProject(file.getContent(), outProject, outFormat, lazyPropertyValues);
+}
+
+void CmagProjectFile::writeProject(const CmagProject &project, std::ostream &out, CmagProjectFormat format) {
+    writeProject(project, project.createBrowserStateSnapshot(), out, format);
+}
+
+void CmagProjectFile::writeProject(const CmagProject &project, const CmagBrowserStateSnapshot &state, std::ostream &out, CmagProjectFormat format) {
+    switch (format) {
+    case CmagProjectFormat::Json:
+        CmagJsonWriter::writeProject(project, state, out);
+        break;
+    case CmagProjectFormat::Binary:
+        CmagBinaryWriter::writeProject(project, state, out);
+        break;
+    default:
+        UNREACHABLE_CODE;
+    }
+}
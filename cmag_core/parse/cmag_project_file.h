@@ -0,0 +1,32 @@
+#pragma once
+
+#include "cmag_core/core/cmag_project.h"
+#include "cmag_core/parse/parse_result.h"
+#include "cmag_core/utils/filesystem.h"
+
+#include <ios>
+#include <ostream>
+#include <string_view>
+
+enum class CmagProjectFormat {
+    Json,
+    Binary,
+};
+
+// Entry point for reading and writing whole project files. Both formats hold exactly the same data, the format of
+// an existing file is detected by its content, not by its extension.
+class CmagProjectFile {
+public:
+    static CmagProjectFormat detectFormat(std::string_view content);
+    static CmagProjectFormat getOtherFormat(CmagProjectFormat format);
+    static const char *getExtension(CmagProjectFormat format);
+    static fs::path getPathForFormat(const fs::path &path, CmagProjectFormat format);
+    static std::ios::openmode getOpenMode(CmagProjectFormat format);
+
+    // Lazy loading stores raw data of the file in the project and makes property values views into it, instead of copying
+    // each of them. In json files it only applies to values without escape sequences.
+    static ParseResult parseProject(std::string_view content, CmagProject &outProject, CmagProjectFormat *outFormat = nullptr, bool lazyPropertyValues = false);
+    static ParseResult readProject(const fs::path &path, CmagProject &outProject, CmagProjectFormat *outFormat = nullptr, bool lazyPropertyValues = false);
+    static void writeProject(const CmagProject &project, std::ostream &out, CmagProjectFormat format);
+    static void writeProject(const CmagProject &project, const CmagBrowserStateSnapshot &state, std::ostream &out, CmagProjectFormat format);
+};
@@ -0,0 +1,146 @@
+#include "json_structure_index.h"
+
+bool CmagJsonStructureIndex::build(std::string_view newJson) {
+    json = newJson;
+    positions.clear();
+    matchingBrackets.clear();
+    if (json.size() > UINT32_MAX) {
+        return false;
+    }
+
+    std::vector<uint32_t> openBrackets = {};
+    for (size_t position = 0; position < json.size(); position++) {
+        switch (json[position]) {
+        case '"':
+            // Skip the string, taking escaped characters into account.
+            for (position++;; position += 2) {
+                position = json.find_first_of("\"\\", position);
+                if (position == std::string_view::npos) {
+                    return false;
+                }
+                if (json[position] == '"') {
+                    break;
+                }
+            }
+            break;
+        case '\'':
+            // Raw strings cannot contain any escapes, they end on the first three apostrophes.
+            if (json.substr(position, 3) != "'''") {
+                return false;
+            }
+            position = json.find("'''", position + 3);
+            if (position == std::string_view::npos) {
+                return false;
+            }
+            position += 2;
+            break;
+        case '{':
+        case '[':
+            openBrackets.push_back(static_cast<uint32_t>(positions.size()));
+            positions.push_back(static_cast<uint32_t>(position));
+            matchingBrackets.push_back(0);
+            break;
+        case '}':
+        case ']': {
+            const char expectedOpenBracket = json[position] == '}' ? '{' : '[';
+            if (openBrackets.empty() || json[positions[openBrackets.back()]] != expectedOpenBracket) {
+                return false;
+            }
+            const auto index = static_cast<uint32_t>(positions.size());
+            matchingBrackets[openBrackets.back()] = index;
+            positions.push_back(static_cast<uint32_t>(position));
+            matchingBrackets.push_back(openBrackets.back());
+            openBrackets.pop_back();
+            break;
+        }
+        case ':':
+        case ',':
+            positions.push_back(static_cast<uint32_t>(position));
+            matchingBrackets.push_back(0);
+            break;
+        default:
+            break;
+        }
+    }
+    return openBrackets.empty();
+}
+
+bool CmagJsonStructureIndex::collectRootMembers(std::vector<Member> &outMembers) const {
+    // Root has to be an object spanning the whole document.
+    if (!isObject(0) || !isWhitespace(getText(0, positions[0]))) {
+        return false;
+    }
+    const size_t closingIndex = matchingBrackets[0];
+    if (!isWhitespace(getText(positions[closingIndex] + 1, json.size()))) {
+        return false;
+    }
+    return collectObjectMembers(0, outMembers);
+}
+
+bool CmagJsonStructureIndex::collectObjectMembers(size_t structuralIndex, std::vector<Member> &outMembers) const {
+    outMembers.clear();
+    if (!isObject(structuralIndex)) {
+        return false;
+    }
+
+    const size_t closingIndex = matchingBrackets[structuralIndex];
+    size_t index = structuralIndex + 1;
+    size_t textBegin = positions[structuralIndex] + 1;
+    if (index == closingIndex) {
+        return isWhitespace(getText(textBegin, positions[closingIndex]));
+    }
+
+    while (true) {
+        // Key is everything before a colon.
+        if (index == closingIndex || json[positions[index]] != ':') {
+            return false;
+        }
+        Member member = {};
+        member.key = trim(getText(textBegin, positions[index]));
+        textBegin = positions[index] + 1;
+        index++;
+
+        // Value is either a container or a scalar ending at the next structural character. Containers are skipped
+        // as a whole thanks to matched brackets.
+        const char nextCharacter = json[positions[index]];
+        if ((nextCharacter == '{' || nextCharacter == '[') && isWhitespace(getText(textBegin, positions[index]))) {
+            member.valueStructuralIndex = index;
+            index = matchingBrackets[index];
+            member.value = getText(positions[member.valueStructuralIndex], positions[index] + 1);
+            textBegin = positions[index] + 1;
+            index++;
+            if (!isWhitespace(getText(textBegin, positions[index]))) {
+                return false;
+            }
+        } else {
+            member.value = trim(getText(textBegin, positions[index]));
+        }
+        if (member.key.empty() || member.value.empty()) {
+            return false;
+        }
+        outMembers.push_back(member);
+
+        // Members are separated with commas.
+        if (index == closingIndex) {
+            return true;
+        }
+        if (json[positions[index]] != ',') {
+            return false;
+        }
+        textBegin = positions[index] + 1;
+        index++;
+    }
+}
+
+bool CmagJsonStructureIndex::isWhitespace(std::string_view text) {
+    return text.find_first_not_of(" \t\n\r") == std::string_view::npos;
+}
+
+std::string_view CmagJsonStructureIndex::trim(std::string_view text) {
+    const size_t begin = text.find_first_not_of(" \t\n\r");
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+    const size_t end = text.find_last_not_of(" \t\n\r");
+    return text.substr(begin, end - begin + 1);
+}
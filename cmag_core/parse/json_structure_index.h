@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// First stage of json parsing, in the style of simdjson. A single pass over the document finds positions of all
+// structural characters, i.e. brackets, colons and commas outside of strings, and matches the brackets. This is
+// enough to split the document into independent values without tokenizing it, so the values can be parsed
+// concurrently by a regular parser. Strings can be either normal json strings or raw strings delimited with ''',
+// which are emitted by the postamble.
+//
+// Only strings and brackets are validated along with the structure of walked objects. Values still have to be parsed
+// by a real parser, which reports all other errors.
+class CmagJsonStructureIndex {
+public:
+    struct Member {
+        std::string_view key;   // including quotes
+        std::string_view value; // without surrounding whitespace
+        size_t valueStructuralIndex = SIZE_MAX; // index of the opening bracket for containers, SIZE_MAX for scalars
+    };
+
+    bool build(std::string_view newJson);
+
+    // These methods return false, if the object is not well-formed. Objects are identified by the index of their
+    // opening bracket within structural characters.
+    bool collectRootMembers(std::vector<Member> &outMembers) const;
+    bool collectObjectMembers(size_t structuralIndex, std::vector<Member> &outMembers) const;
+    bool isObject(size_t structuralIndex) const { return structuralIndex < positions.size() && json[positions[structuralIndex]] == '{'; }
+
+private:
+    static bool isWhitespace(std::string_view text);
+    static std::string_view trim(std::string_view text);
+    std::string_view getText(size_t begin, size_t end) const { return json.substr(begin, end - begin); }
+
+    std::string_view json = {};
+    std::vector<uint32_t> positions = {};          // positions of structural characters within the document
+    std::vector<uint32_t> matchingBrackets = {}; // for brackets, index of the matching bracket, undefined otherwise
+};
@@ -0,0 +1,12 @@
+#include "parse_result.h"
+
+#include "cmag_core/utils/error.h"
+
+ParseResult::ParseResult(ParseResultStatus status, const std::string &errorMessage)
+    : status(status),
+      errorMessage(errorMessage) {
+    const bool isSuccess = status == ParseResultStatus::Success;
+    FATAL_ERROR_IF(isSuccess != errorMessage.empty(), "Invalid parse result");
+}
+
+const ParseResult ParseResult::success(ParseResultStatus::Success, "");
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+
+enum class ParseResultStatus {
+    Success,
+    Malformed,
+    InvalidNodeType,
+    InvalidValue,
+    MissingField,
+    DataDerivationFailed,
+    VersionMismatch,
+    FileAccessError,
+};
+
+struct ParseResult {
+    ParseResult(ParseResultStatus status, const std::string &errorMessage);
+
+    ParseResultStatus status = ParseResultStatus::Success;
+    std::string errorMessage = {};
+
+    const static ParseResult success;
+};
@@ -234,38 +234,69 @@ function(json_append_target OUT_VARIABLE TGT CONFIG INDENT INDENT_INCREMENT)
     set(${OUT_VARIABLE} ${${OUT_VARIABLE}} PARENT_SCOPE)
 endfunction()
 
-function (get_all_targets OUT_VARIABLE DIR)
-    # Call for this directory
-    get_property(BUILDSYSTEM_TARGETS DIRECTORY ${DIR} PROPERTY BUILDSYSTEM_TARGETS)
-    get_property(IMPORTED_TARGETS DIRECTORY ${DIR} PROPERTY IMPORTED_TARGETS)
-    set(TARGETS ${BUILDSYSTEM_TARGETS} ${IMPORTED_TARGETS})
-
-    # Store list dir for this target in a global property. We cannot use target property, because some targets may not
-    # be visible in this postamble.
-    foreach(TARGET ${TARGETS})
-        set_property(GLOBAL PROPERTY CMAG_LIST_DIR_${TARGET} ${DIR})
-    endforeach ()
+function (assign_list_dirs_to_targets LIST_DIRS)
+    # Store list dir for each target in a global property. We cannot use target property, because some targets may not
+    # be visible in this postamble. Non-global imported targets can be visible in multiple directories, in which case
+    # the last one is used.
+    foreach(LIST_DIR ${LIST_DIRS})
+        get_property(BUILDSYSTEM_TARGETS DIRECTORY ${LIST_DIR} PROPERTY BUILDSYSTEM_TARGETS)
+        get_property(IMPORTED_TARGETS DIRECTORY ${LIST_DIR} PROPERTY IMPORTED_TARGETS)
+        foreach(TGT ${BUILDSYSTEM_TARGETS} ${IMPORTED_TARGETS})
+            set_property(GLOBAL PROPERTY CMAG_LIST_DIR_${TGT} ${LIST_DIR})
+        endforeach()
+    endforeach()
+endfunction()
 
-    # Call for subdirectories recursively
+function (get_all_list_dirs OUT_VARIABLE DIR)
+    set(DIRS ${DIR})
     get_property(SUBDIRS DIRECTORY ${DIR} PROPERTY SUBDIRECTORIES)
     foreach (SUBDIR ${SUBDIRS})
-        get_all_targets(${OUT_VARIABLE} ${SUBDIR})
+        get_all_list_dirs(SUBDIR_DIRS ${SUBDIR})
+        list(APPEND DIRS ${SUBDIR_DIRS})
     endforeach ()
 
-    # Propagate to outer scope
-    set(${OUT_VARIABLE} ${${OUT_VARIABLE}} ${TARGETS} PARENT_SCOPE)
+    set(${OUT_VARIABLE} ${DIRS} PARENT_SCOPE)
+endfunction()
+
+function (get_list_dir_targets OUT_VARIABLE DIR)
+    get_property(BUILDSYSTEM_TARGETS DIRECTORY ${DIR} PROPERTY BUILDSYSTEM_TARGETS)
+    get_property(IMPORTED_TARGETS DIRECTORY ${DIR} PROPERTY IMPORTED_TARGETS)
+
+    # Non-global imported targets can be visible in multiple directories. Each target is written only once, in the
+    # directory assigned to it by assign_list_dirs_to_targets.
+    set(TARGETS)
+    foreach(TGT ${BUILDSYSTEM_TARGETS} ${IMPORTED_TARGETS})
+        get_property(listDir GLOBAL PROPERTY CMAG_LIST_DIR_${TGT})
+        if ("${listDir}" STREQUAL "${DIR}")
+            list(APPEND TARGETS ${TGT})
+        endif()
+    endforeach()
+    if (NOT "${TARGETS}d" STREQUAL "d")
+        list(REMOVE_DUPLICATES TARGETS)
+    endif()
+
+    set(${OUT_VARIABLE} ${TARGETS} PARENT_SCOPE)
 endfunction()
 
-function(json_append_targets OUT_VARIABLE CONFIG INDENT INDENT_INCREMENT)
+function(json_append_targets OUT_VARIABLE TARGETS CONFIG INDENT INDENT_INCREMENT)
     set(INNER_INDENT "${INDENT}${INDENT_INCREMENT}")
 
-    get_all_targets(ALL_TARGETS ${CMAKE_CURRENT_SOURCE_DIR})
+    # Each target is assembled in its own small variable and all of them are joined once at the end. Appending all
+    # targets to one variable would be quadratic, because stripping trailing commas and returning from helpers with
+    # PARENT_SCOPE scan or copy the whole variable.
+    set(TARGET_FRAGMENTS)
+    foreach(TGT ${TARGETS})
+        set(TARGET_JSON "")
+        json_append_target(TARGET_JSON ${TGT} ${CONFIG} ${INNER_INDENT} ${INDENT_INCREMENT})
+        string(REGEX REPLACE ",\n$" "" TARGET_JSON "${TARGET_JSON}")
+        list(APPEND TARGET_FRAGMENTS "${TARGET_JSON}")
+    endforeach()
+    string(JOIN ",\n" JOINED_TARGETS_JSON ${TARGET_FRAGMENTS})
 
     json_append_line(${OUT_VARIABLE} "{" ${INDENT})
-    foreach(TGT ${ALL_TARGETS})
-        json_append_target(${OUT_VARIABLE} ${TGT} ${CONFIG} ${INNER_INDENT} ${INDENT_INCREMENT})
-    endforeach()
-    json_strip_trailing_comma()
+    if (NOT "${JOINED_TARGETS_JSON}d" STREQUAL "d")
+        string(APPEND ${OUT_VARIABLE} "${JOINED_TARGETS_JSON}\n")
+    endif()
     json_append_line(${OUT_VARIABLE} "}" ${INDENT})
 
     set(${OUT_VARIABLE} ${${OUT_VARIABLE}} PARENT_SCOPE)
@@ -276,27 +307,27 @@ endfunction()
 
 
 # -------------------------------------------------------------------- Assembling JSON for .cmag-globals file
-function (json_append_lists_files OUT_VARIABLE DIR INDENT INDENT_INCREMENT)
+function (json_append_lists_files OUT_VARIABLE LIST_DIRS INDENT INDENT_INCREMENT)
     set(INNER_INDENT "${INDENT}${INDENT_INCREMENT}")
 
-    # Get immediate subdirectories
-    get_property(SUBDIRS DIRECTORY ${DIR} PROPERTY SUBDIRECTORIES)
-
-    # Write current dir and its immediate subdirectories
-    if ("${SUBDIRS}d" STREQUAL "d")
-        string(APPEND ${OUT_VARIABLE} "${INDENT}\"${DIR}\": [],\n")
-    else ()
-        string(APPEND ${OUT_VARIABLE} "${INDENT}\"${DIR}\": [\n")
+    # Write each dir with its immediate subdirectories. Just like targets, they are assembled separately and joined once.
+    set(DIR_FRAGMENTS)
+    foreach (LIST_DIR ${LIST_DIRS})
+        get_property(SUBDIRS DIRECTORY ${LIST_DIR} PROPERTY SUBDIRECTORIES)
+        set(SUBDIR_LINES)
         foreach (SUBDIR ${SUBDIRS})
-            json_append_line(${OUT_VARIABLE} "\"${SUBDIR}\"," ${INNER_INDENT})
+            list(APPEND SUBDIR_LINES "${INNER_INDENT}\"${SUBDIR}\"")
         endforeach ()
-        json_append_array_end(${OUT_VARIABLE} ${INDENT})
-    endif()
 
-    # Execute recursively
-    foreach (SUBDIR ${SUBDIRS})
-        json_append_lists_files(${OUT_VARIABLE} ${SUBDIR} ${INDENT} ${INDENT_INCREMENT})
+        if ("${SUBDIR_LINES}d" STREQUAL "d")
+            list(APPEND DIR_FRAGMENTS "${INDENT}\"${LIST_DIR}\": []")
+        else ()
+            string(JOIN ",\n" SUBDIRS_JSON ${SUBDIR_LINES})
+            list(APPEND DIR_FRAGMENTS "${INDENT}\"${LIST_DIR}\": [\n${SUBDIRS_JSON}\n${INDENT}]")
+        endif()
     endforeach ()
+    string(JOIN ",\n" DIRS_JSON ${DIR_FRAGMENTS})
+    string(APPEND ${OUT_VARIABLE} "${DIRS_JSON},\n")
 
     # Propagate to outer scope
     set(${OUT_VARIABLE} ${${OUT_VARIABLE}} PARENT_SCOPE)
@@ -315,7 +346,7 @@ function (json_append_globals_browser OUT_VARIABLE SELECTED_CONFIG INDENT INDENT
     set(${OUT_VARIABLE} ${${OUT_VARIABLE}} PARENT_SCOPE)
 endfunction()
 
-function(json_append_globals OUT_VARIABLE SELECTED_CONFIG INDENT INDENT_INCREMENT)
+function(json_append_globals OUT_VARIABLE SELECTED_CONFIG LIST_DIRS INDENT INDENT_INCREMENT)
     set(INNER_INDENT "${INDENT}${INDENT_INCREMENT}")
     set(INNER_INNER_INDENT "${INDENT}${INDENT_INCREMENT}${INDENT_INCREMENT}")
 
@@ -339,7 +370,7 @@ function(json_append_globals OUT_VARIABLE SELECTED_CONFIG INDENT INDENT_INCREMEN
     json_append_object_end(${OUT_VARIABLE} ${INNER_INDENT})
 
     json_append_object_begin(${OUT_VARIABLE} "listDirs" ${INNER_INDENT})
-    json_append_lists_files(${OUT_VARIABLE} ${CMAKE_CURRENT_SOURCE_DIR} ${INNER_INNER_INDENT} ${INDENT_INCREMENT})
+    json_append_lists_files(${OUT_VARIABLE} "${LIST_DIRS}" ${INNER_INNER_INDENT} ${INDENT_INCREMENT})
     json_append_object_end(${OUT_VARIABLE} ${INNER_INDENT})
 
     json_strip_trailing_comma()
@@ -353,15 +384,23 @@ endfunction()
 
 
 # -------------------------------------------------------------------- Assembling JSON for .cmag-targets-list file
-function(json_append_configs OUT_VARIABLE CONFIGS INDENT INDENT_INCREMENT)
+function(json_append_configs OUT_VARIABLE CONFIGS SHARDS_COUNT INDENT INDENT_INCREMENT)
     set(INNER_INDENT "${INDENT}${INDENT_INCREMENT}")
 
-    json_append_line(${OUT_VARIABLE} "[" ${INDENT})
+    set(LINES)
     foreach(CONFIG ${CONFIGS})
-        set(LINE "${CMAG_PROJECT_NAME}_${CONFIG}.cmag-targets")
-        json_append_line(${OUT_VARIABLE} "\"${LINE}\"," ${INNER_INDENT})
+        set(SHARD_INDEX 0)
+        while (SHARD_INDEX LESS SHARDS_COUNT)
+            list(APPEND LINES "${INNER_INDENT}\"${CMAG_PROJECT_NAME}_${CONFIG}_${SHARD_INDEX}.cmag-targets\"")
+            math(EXPR SHARD_INDEX "${SHARD_INDEX} + 1")
+        endwhile()
     endforeach()
-    json_strip_trailing_comma()
+    string(JOIN ",\n" FILES_JSON ${LINES})
+
+    json_append_line(${OUT_VARIABLE} "[" ${INDENT})
+    if (NOT "${FILES_JSON}d" STREQUAL "d")
+        string(APPEND ${OUT_VARIABLE} "${FILES_JSON}\n")
+    endif()
     json_append_line(${OUT_VARIABLE} "]" ${INDENT})
 
     set(${OUT_VARIABLE} ${${OUT_VARIABLE}} PARENT_SCOPE)
@@ -420,35 +459,50 @@ function(cmag_postamble_main)
     endif()
     file(WRITE "${PROJECT_NAME_FILE}" "${CMAG_PROJECT_NAME}")
 
-    # Write configs list
-    set(TARGETS_LIST_FILE "${CMAKE_BINARY_DIR}/${CMAG_PROJECT_NAME}.cmag-targets-list")
-    if (CMAG_JSON_DEBUG)
-        message(STATUS "cmag: generating file ${TARGETS_LIST_FILE}")
-    endif()
-    json_append_configs(CONFIGS_JSON "${CMAG_CONFIGS}" "  " "  ")
-    file(WRITE "${TARGETS_LIST_FILE}" "${CONFIGS_JSON}")
+    get_all_list_dirs(LIST_DIRS ${CMAKE_CURRENT_SOURCE_DIR})
+    assign_list_dirs_to_targets("${LIST_DIRS}")
 
     # Write global settings
     set(GLOBALS_FILE "${CMAKE_BINARY_DIR}/${CMAG_PROJECT_NAME}.cmag-globals")
     if (CMAG_JSON_DEBUG)
         message(STATUS "cmag: generating file ${GLOBALS_FILE}")
     endif()
-    json_append_globals(GLOBALS_JSON "${CMAG_CONFIG_DEFAULT}" "  " "  ")
+    json_append_globals(GLOBALS_JSON "${CMAG_CONFIG_DEFAULT}" "${LIST_DIRS}" "  " "  ")
     file(WRITE "${GLOBALS_FILE}" "${GLOBALS_JSON}")
 
-    # Write per-config targets
-    set(TARGETS_LIST_FILE "${CMAKE_BINARY_DIR}/${CMAG_PROJECT_NAME}_${CMAG_CONFIG}.cmag-targets")
-    if (CMAG_JSON_DEBUG)
-        message(STATUS "cmag: generating file ${TARGETS_LIST_FILE}")
-    endif()
-    json_append_targets(TARGETS_JSON "${CMAG_CONFIG}" "  " "  ")
-    file(GENERATE OUTPUT "${TARGETS_LIST_FILE}" CONTENT "${TARGETS_JSON}")
+    # Write per-config targets. They are split into shards, one for each list dir containing targets. This way CMake
+    # never holds json of all targets in one variable and cmag can parse the shards concurrently.
+    set(SHARDS_COUNT 0)
+    foreach(LIST_DIR ${LIST_DIRS})
+        get_list_dir_targets(LIST_DIR_TARGETS ${LIST_DIR})
+        if ("${LIST_DIR_TARGETS}d" STREQUAL "d")
+            continue()
+        endif()
+
+        set(TARGETS_FILE "${CMAKE_BINARY_DIR}/${CMAG_PROJECT_NAME}_${CMAG_CONFIG}_${SHARDS_COUNT}.cmag-targets")
+        if (CMAG_JSON_DEBUG)
+            message(STATUS "cmag: generating file ${TARGETS_FILE}")
+        endif()
+        set(TARGETS_JSON "")
+        json_append_targets(TARGETS_JSON "${LIST_DIR_TARGETS}" "${CMAG_CONFIG}" "  " "  ")
+        file(GENERATE OUTPUT "${TARGETS_FILE}" CONTENT "${TARGETS_JSON}")
+
+        if (CMAG_JSON_DEBUG)
+            set(TARGETS_DEBUG_FILE "${CMAKE_BINARY_DIR}/${CMAG_PROJECT_NAME}_${SHARDS_COUNT}.cmag-targets.debug")
+            message(STATUS "cmag: generating file ${TARGETS_DEBUG_FILE}")
+            file(WRITE "${TARGETS_DEBUG_FILE}" "${TARGETS_JSON}")
+        endif()
+
+        math(EXPR SHARDS_COUNT "${SHARDS_COUNT} + 1")
+    endforeach()
 
+    # Write list of targets files
+    set(TARGETS_LIST_FILE "${CMAKE_BINARY_DIR}/${CMAG_PROJECT_NAME}.cmag-targets-list")
     if (CMAG_JSON_DEBUG)
-        set(TARGETS_LIST_DEBUG_FILE "${CMAKE_BINARY_DIR}/${CMAG_PROJECT_NAME}.cmag-targets.debug")
-        message(STATUS "cmag: generating file ${TARGETS_LIST_DEBUG_FILE}")
-        file(WRITE "${TARGETS_LIST_DEBUG_FILE}" "${TARGETS_JSON}")
+        message(STATUS "cmag: generating file ${TARGETS_LIST_FILE}")
     endif()
+    json_append_configs(CONFIGS_JSON "${CMAG_CONFIGS}" ${SHARDS_COUNT} "  " "  ")
+    file(WRITE "${TARGETS_LIST_FILE}" "${CONFIGS_JSON}")
 endfunction()
 
 function(cmag_postamble_aliases)
@@ -1,15 +1,76 @@
+#pragma once
+
 #include "cmag_core/utils/filesystem.h"
+#include "cmag_core/utils/mapped_file.h"
 
 #include <fstream>
 #include <optional>
 #include <sstream>
+#include <string>
+#include <string_view>
 
-inline std::optional<std::string> readFile(const fs::path &path) {
-    std::ifstream stream(path);
+// Reads the whole file into a buffer allocated once with the size of the file. Streams without a known size, like
+// pipes, are read in pieces.
+inline bool readFileToBuffer(const fs::path &path, std::string &outBuffer, std::ios::openmode mode = std::ios::in) {
+    std::ifstream stream(path, mode);
     if (!stream) {
+        return false;
+    }
+
+    stream.seekg(0, std::ios::end);
+    const std::streamoff size = stream.tellg();
+    if (size < 0) {
+        stream.clear();
+        std::ostringstream buffer;
+        buffer << stream.rdbuf();
+        outBuffer = buffer.str();
+        return true;
+    }
+
+    // In text mode less characters than the file size can be read, because of newline conversions.
+    outBuffer.resize(static_cast<size_t>(size));
+    stream.seekg(0, std::ios::beg);
+    stream.read(outBuffer.data(), size);
+    outBuffer.resize(static_cast<size_t>(stream.gcount()));
+    return true;
+}
+
+inline std::optional<std::string> readFile(const fs::path &path) {
+    std::string result = {};
+    if (!readFileToBuffer(path, result)) {
         return {};
     }
-    std::ostringstream buffer;
-    buffer << stream.rdbuf();
-    return buffer.str();
-}
\ No newline at end of file
+    return result;
+}
+
+// Read-only content of a whole file, which avoids copying it whenever possible. The file is mapped into memory and
+// only if that fails, e.g. for files which cannot be mapped, it is read into an owned buffer. Content is read in
+// binary mode in both cases. The view is valid as long as the object is alive.
+class FileView {
+public:
+    FileView() = default;
+    FileView(const FileView &) = delete;
+    FileView &operator=(const FileView &) = delete;
+
+    bool open(const fs::path &path) {
+        buffer.clear();
+        if (mappedFile.open(path)) {
+            content = mappedFile.getContent();
+            return true;
+        }
+        if (readFileToBuffer(path, buffer, std::ios::in | std::ios::binary)) {
+            content = buffer;
+            return true;
+        }
+        content = {};
+        return false;
+    }
+
+    bool isMapped() const { return mappedFile.isOpen(); }
+    std::string_view getContent() const { return content; }
+
+private:
+    MappedFile mappedFile = {};
+    std::string buffer = {};
+    std::string_view content = {};
+};
@@ -0,0 +1,46 @@
+#include "cmag_core/utils/linux/error.h"
+#include "cmag_core/utils/mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool MappedFile::open(const fs::path &path) {
+    close();
+
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode)) {
+        FATAL_ERROR_ON_FAILED_SYSCALL(::close(fd));
+        return false;
+    }
+
+    // Mapping zero bytes is not allowed, but an empty file is still a valid file.
+    void *mapping = nullptr;
+    if (fileStat.st_size > 0) {
+        mapping = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    FATAL_ERROR_ON_FAILED_SYSCALL(::close(fd)); // the mapping holds its own reference to the file
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    opened = true;
+    data = static_cast<const char *>(mapping);
+    size = static_cast<size_t>(fileStat.st_size);
+    return true;
+}
+
+void MappedFile::close() {
+    if (data != nullptr) {
+        FATAL_ERROR_ON_FAILED_SYSCALL(munmap(const_cast<char *>(data), size));
+    }
+    opened = false;
+    data = nullptr;
+    size = 0;
+}
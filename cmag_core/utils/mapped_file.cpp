@@ -0,0 +1,26 @@
+#include "mapped_file.h"
+
+#include <utility>
+
+MappedFile::MappedFile(MappedFile &&other) noexcept {
+    swap(other);
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+        close();
+        swap(other);
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+void MappedFile::swap(MappedFile &other) {
+    std::swap(opened, other.opened);
+    std::swap(data, other.data);
+    std::swap(size, other.size);
+    std::swap(mappingHandle, other.mappingHandle);
+}
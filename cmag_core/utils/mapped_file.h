@@ -0,0 +1,31 @@
+#pragma once
+
+#include "cmag_core/utils/filesystem.h"
+
+#include <string_view>
+
+// Read-only view of a whole file mapped into memory. Contents are loaded lazily by the OS, so opening even a big
+// file is cheap and no copy to a user buffer is made. The view is valid as long as the object is alive.
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+    ~MappedFile();
+
+    bool open(const fs::path &path);
+    void close();
+
+    bool isOpen() const { return opened; }
+    std::string_view getContent() const { return {data, size}; }
+
+private:
+    void swap(MappedFile &other);
+
+    bool opened = false;
+    const char *data = nullptr;
+    size_t size = 0;
+    void *mappingHandle = nullptr; // only used on Windows
+};
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstring>
+#include <iterator>
+#include <memory_resource>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -9,36 +12,154 @@
     char name[4096];                     \
     snprintf(name, sizeof(name), format, __VA_ARGS__);
 
-inline std::vector<std::string_view> splitStringByChar(std::string_view value, bool ignoreSingleEntry, char separator) {
+inline size_t findSubstring(std::string_view value, std::string_view pattern, size_t offset) {
+    // Jump between occurrences of the first character with memchr and only then compare the rest. Patterns we look
+    // for start with rare characters, so this is a lot faster than comparing at every position.
+    if (pattern.empty()) {
+        return offset <= value.size() ? offset : std::string_view::npos;
+    }
+    while (offset + pattern.size() <= value.size()) {
+        const void *candidate = std::memchr(value.data() + offset, pattern[0], value.size() - pattern.size() + 1 - offset);
+        if (candidate == nullptr) {
+            break;
+        }
+        offset = static_cast<size_t>(static_cast<const char *>(candidate) - value.data());
+        if (std::memcmp(value.data() + offset + 1, pattern.data() + 1, pattern.size() - 1) == 0) {
+            return offset;
+        }
+        offset++;
+    }
+    return std::string_view::npos;
+}
+
+// Copies the string to memory allocated from the resource and returns a view of the copy. The memory is never
+// deallocated, so it's meant for monotonic resources, which release everything at once.
+inline std::string_view storeString(std::string_view value, std::pmr::memory_resource *memoryResource) {
     if (value.empty()) {
         return {};
     }
+    char *storage = static_cast<char *>(memoryResource->allocate(value.size(), 1));
+    std::memcpy(storage, value.data(), value.size());
+    return std::string_view{storage, value.size()};
+}
 
-    std::vector<std::string_view> result = {};
+// Lazily splits a string into entries, without allocating any memory. In CMake list syntax, separators escaped with
+// a backslash or nested in square brackets or genexes are a part of an entry. Returned entries are not unescaped.
+class StringSplitRange {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view *;
+        using reference = std::string_view;
 
-    size_t currentPosition = 0;
-    size_t semicolonPosition = 0;
-    while ((semicolonPosition = value.find(separator, currentPosition)) != std::string::npos) {
-        std::string_view entry = std::string_view{value}.substr(currentPosition, semicolonPosition - currentPosition);
-        result.push_back(entry);
+        Iterator() = default;
+        std::string_view operator*() const { return value.substr(entryStart, entryEnd - entryStart); }
+        Iterator &operator++() {
+            if (entryEnd == value.size()) {
+                entryStart = std::string_view::npos;
+            } else {
+                entryStart = entryEnd + 1;
+                entryEnd = findSeparator(value, entryStart, separator, cmakeSyntax);
+            }
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator result = *this;
+            ++*this;
+            return result;
+        }
+        bool operator==(const Iterator &other) const { return entryStart == other.entryStart; }
+        bool operator!=(const Iterator &other) const { return entryStart != other.entryStart; }
+
+    private:
+        friend StringSplitRange;
+        std::string_view value = {};
+        char separator = {};
+        bool cmakeSyntax = false;
+        size_t entryStart = std::string_view::npos; // npos for end iterator
+        size_t entryEnd = std::string_view::npos;
+    };
 
-        currentPosition = semicolonPosition + 1;
+    StringSplitRange() = default;
+    StringSplitRange(std::string_view value, bool ignoreSingleEntry, char separator, bool cmakeSyntax) {
+        first.value = value;
+        first.separator = separator;
+        first.cmakeSyntax = cmakeSyntax && hasCmakeSyntaxCharacters(value);
+        if (!value.empty()) {
+            first.entryStart = 0;
+            first.entryEnd = findSeparator(value, 0, separator, first.cmakeSyntax);
+            if (ignoreSingleEntry && first.entryEnd == value.size()) {
+                first = {};
+            }
+        }
     }
 
-    if (ignoreSingleEntry && result.empty()) {
-        return {};
+    Iterator begin() const { return first; }
+    Iterator end() const { return {}; }
+    bool empty() const { return first == Iterator{}; }
+
+private:
+    static bool hasCmakeSyntaxCharacters(std::string_view value) {
+        for (char character : {'\\', '[', '$'}) {
+            if (std::memchr(value.data(), character, value.size()) != nullptr) {
+                return true;
+            }
+        }
+        return false;
     }
 
-    std::string_view entry = std::string_view{value}.substr(currentPosition);
-    result.push_back(entry);
+    static size_t findSeparator(std::string_view value, size_t offset, char separator, bool cmakeSyntax) {
+        if (!cmakeSyntax) {
+            const void *result = std::memchr(value.data() + offset, separator, value.size() - offset);
+            return result != nullptr ? static_cast<size_t>(static_cast<const char *>(result) - value.data()) : value.size();
+        }
 
-    return result;
+        size_t squareBracketDepth = 0;
+        size_t genexDepth = 0;
+        for (size_t position = offset; position < value.size(); position++) {
+            const char currentChar = value[position];
+            const char nextChar = position + 1 < value.size() ? value[position + 1] : '\0';
+            if (currentChar == '\\' && nextChar == separator) {
+                position++;
+            } else if (currentChar == '[') {
+                squareBracketDepth++;
+            } else if (currentChar == ']' && squareBracketDepth > 0) {
+                squareBracketDepth--;
+            } else if (currentChar == '$' && nextChar == '<') {
+                genexDepth++;
+                position++;
+            } else if (currentChar == '>' && genexDepth > 0) {
+                genexDepth--;
+            } else if (currentChar == separator && squareBracketDepth == 0 && genexDepth == 0) {
+                return position;
+            }
+        }
+        return value.size();
+    }
+
+    Iterator first = {};
+};
+
+inline StringSplitRange iterateStringByChar(std::string_view value, bool ignoreSingleEntry, char separator) {
+    return StringSplitRange{value, ignoreSingleEntry, separator, false};
 }
 
-inline std::vector<std::string_view> splitCmakeListString(std::string_view value, bool ignoreSingleEntry) {
+inline StringSplitRange iterateCmakeListString(std::string_view value, bool ignoreSingleEntry) {
     // If property value contains semicolons, most probably it's a list, because CMake delimits list entries with semicolons.
-    // Split the value, so we can display it as a list of bullets in popup.
-    return splitStringByChar(value, ignoreSingleEntry, ';');
+    return StringSplitRange{value, ignoreSingleEntry, ';', true};
+}
+
+inline std::vector<std::string_view> splitStringByChar(std::string_view value, bool ignoreSingleEntry, char separator) {
+    const StringSplitRange range = iterateStringByChar(value, ignoreSingleEntry, separator);
+    return std::vector<std::string_view>(range.begin(), range.end());
+}
+
+inline std::vector<std::string_view> splitCmakeListString(std::string_view value, bool ignoreSingleEntry) {
+    const StringSplitRange range = iterateCmakeListString(value, ignoreSingleEntry);
+    return std::vector<std::string_view>(range.begin(), range.end());
 }
 
 inline std::string joinStringWithChar(const std::vector<std::string> &strings, char separator) {
@@ -0,0 +1,97 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(size_t threadsCount) {
+    threadsCount = std::max<size_t>(threadsCount, 1);
+    for (size_t i = 1; i < threadsCount; i++) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard lock{mutex};
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+}
+
+size_t ThreadPool::getDefaultThreadsCount() {
+    // hardware_concurrency() can return 0, if it's not able to tell.
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)> &function) {
+    if (count == 0) {
+        return;
+    }
+    if (workers.empty() || count == 1) {
+        for (size_t index = 0; index < count; index++) {
+            function(index);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard lock{mutex};
+        currentFunction = &function;
+        currentCount = count;
+        currentChunkSize = std::max<size_t>(count / (getThreadsCount() * 8), 1);
+        nextIndex = 0;
+        activeWorkersCount = workers.size();
+        generation++;
+    }
+    workAvailable.notify_all();
+
+    executeChunks();
+
+    std::unique_lock lock{mutex};
+    workFinished.wait(lock, [this]() { return activeWorkersCount == 0; });
+    currentFunction = nullptr;
+}
+
+void ThreadPool::workerLoop() {
+    size_t lastGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock lock{mutex};
+            workAvailable.wait(lock, [&]() { return stopping || generation != lastGeneration; });
+            if (stopping) {
+                return;
+            }
+            lastGeneration = generation;
+        }
+
+        executeChunks();
+
+        {
+            std::lock_guard lock{mutex};
+            activeWorkersCount--;
+        }
+        workFinished.notify_one();
+    }
+}
+
+void ThreadPool::executeChunks() {
+    while (true) {
+        size_t chunkStart = 0;
+        size_t chunkEnd = 0;
+        {
+            std::lock_guard lock{mutex};
+            if (nextIndex >= currentCount) {
+                return;
+            }
+            chunkStart = nextIndex;
+            chunkEnd = std::min(nextIndex + currentChunkSize, currentCount);
+            nextIndex = chunkEnd;
+        }
+
+        for (size_t index = chunkStart; index < chunkEnd; index++) {
+            (*currentFunction)(index);
+        }
+    }
+}
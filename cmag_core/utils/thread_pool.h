@@ -0,0 +1,44 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Simple pool of worker threads, which can split a loop into chunks and execute them concurrently. Thread
+// calling parallelFor() also takes part in the work, so a pool created with one thread doesn't spawn anything.
+class ThreadPool {
+public:
+    ThreadPool() : ThreadPool(getDefaultThreadsCount()) {}
+    explicit ThreadPool(size_t threadsCount);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    static size_t getDefaultThreadsCount();
+    size_t getThreadsCount() const { return workers.size() + 1; }
+
+    // Calls function(index) for each index in range [0, count) and waits for all of the calls to finish.
+    // Order of the calls is unspecified, so the function must not depend on it.
+    void parallelFor(size_t count, const std::function<void(size_t)> &function);
+
+private:
+    void workerLoop();
+    void executeChunks();
+
+    std::vector<std::thread> workers = {};
+    std::mutex mutex = {};
+    std::condition_variable workAvailable = {};
+    std::condition_variable workFinished = {};
+    bool stopping = false;
+
+    // State of the current parallelFor() call. Guarded by the mutex.
+    const std::function<void(size_t)> *currentFunction = nullptr;
+    size_t currentCount = 0;
+    size_t currentChunkSize = 0;
+    size_t nextIndex = 0;
+    size_t activeWorkersCount = 0;
+    size_t generation = 0;
+};
@@ -0,0 +1,57 @@
+#include "cmag_core/utils/error.h"
+#include "cmag_core/utils/mapped_file.h"
+
+#include <Windows.h>
+
+bool MappedFile::open(const fs::path &path) {
+    close();
+
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return false;
+    }
+
+    // Mapping zero bytes is not allowed, but an empty file is still a valid file.
+    if (fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        opened = true;
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file); // the mapping holds its own reference to the file
+    if (mapping == nullptr) {
+        return false;
+    }
+
+    const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    opened = true;
+    data = static_cast<const char *>(view);
+    size = static_cast<size_t>(fileSize.QuadPart);
+    mappingHandle = mapping;
+    return true;
+}
+
+void MappedFile::close() {
+    if (data != nullptr) {
+        FATAL_ERROR_IF(!UnmapViewOfFile(data), "UnmapViewOfFile failed");
+    }
+    if (mappingHandle != nullptr) {
+        FATAL_ERROR_IF(!CloseHandle(mappingHandle), "CloseHandle failed");
+    }
+    opened = false;
+    data = nullptr;
+    size = 0;
+    mappingHandle = nullptr;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+// Benchmarks are not registered in CTest. They should be run manually on a release build and their results compared
+// before and after a change.
+template <typename Function>
+void runBenchmark(const char *name, size_t iterations, Function &&function) {
+    function(); // warmup
+
+    const auto startTime = std::chrono::steady_clock::now();
+    for (size_t iteration = 0; iteration < iterations; iteration++) {
+        function();
+    }
+    const std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - startTime;
+
+    printf("%-50s %12.2f us\n", name, duration.count() / static_cast<double>(iterations));
+}
+
+void runLinkLibrariesBenchmarks();
+void runReachabilityBenchmarks();
+void runDumpBenchmarks();
@@ -0,0 +1,58 @@
+#include "cmag_core/dumper/cmag_dumper.h"
+#include "cmag_core/utils/subprocess.h"
+#include "test/benchmarks/benchmark.h"
+
+static bool prepareBenchmarkProject(std::string_view name, fs::path &outSourcePath) {
+    const fs::path srcProjectDir = fs::path{SRC_PROJECTS_ROOT} / name;
+    const fs::path dstProjectDir = fs::path{BENCHMARK_PROJECTS_ROOT} / name;
+
+    std::error_code err{};
+    fs::remove_all(dstProjectDir, err);
+    fs::create_directories(dstProjectDir, err);
+    fs::copy(srcProjectDir, dstProjectDir / "source", fs::copy_options::recursive, err);
+    outSourcePath = dstProjectDir / "source";
+    return !err;
+}
+
+static void recreateBuildDir(const fs::path &buildPath) {
+    std::error_code err{};
+    fs::remove_all(buildPath, err);
+    fs::create_directories(buildPath, err);
+}
+
+static void runDumpBenchmark(std::string_view projectName) {
+    fs::path sourcePath = {};
+    if (!prepareBenchmarkProject(projectName, sourcePath)) {
+        printf("Could not prepare %s project for benchmarking\n", std::string{projectName}.c_str());
+        return;
+    }
+
+    // Plain CMake configuration is the reference. Dump runs CMake twice, so it is always slower, but the postamble
+    // should not add much on top of that.
+    const fs::path plainBuildPath = sourcePath.parent_path() / "plain_build";
+    const std::string plainName = "plain CMake " + std::string{projectName};
+    runBenchmark(plainName.c_str(), 1, [&]() {
+        recreateBuildDir(plainBuildPath);
+        std::string stdOut = {};
+        std::string stdErr = {};
+        const std::vector<std::string> args = {"cmake", "-S", sourcePath.string(), "-B", plainBuildPath.string()};
+        if (runSubprocess(args, stdOut, stdErr) != SubprocessResult::Success) {
+            printf("Plain CMake failed for %s\n", std::string{projectName}.c_str());
+        }
+    });
+
+    const fs::path dumpBuildPath = sourcePath.parent_path() / "build";
+    const std::string dumpName = "cmag dump " + std::string{projectName};
+    runBenchmark(dumpName.c_str(), 1, [&]() {
+        recreateBuildDir(dumpBuildPath);
+        const std::vector<std::string> args = {"cmake", "-S", sourcePath.string(), "-B", dumpBuildPath.string()};
+        CmagDumper dumper{"project", false, false, sourcePath, dumpBuildPath, args, ""};
+        if (dumper.dump() != CmagResult::Success) {
+            printf("cmag dump failed for %s\n", std::string{projectName}.c_str());
+        }
+    });
+}
+
+void runDumpBenchmarks() {
+    runDumpBenchmark("many_targets");
+}
@@ -0,0 +1,34 @@
+#include "cmag_core/core/cmag_project.h"
+#include "test/benchmarks/benchmark.h"
+
+#include <memory_resource>
+#include <string>
+
+static void runLinkLibrariesFixupBenchmark(size_t librariesCount) {
+    // Every other library is linked from a different directory and every third one is wrapped with $<LINK_ONLY>.
+    std::string evaledValue = {};
+    std::string nonEvaledValue = {};
+    for (size_t libraryIndex = 0; libraryIndex < librariesCount; libraryIndex++) {
+        const std::string library = "Library" + std::to_string(libraryIndex);
+        const std::string separator = libraryIndex > 0 ? ";" : "";
+        const std::string directoryIdStart = libraryIndex % 2 ? "::@(000002F0C2555640);" : "";
+        const std::string directoryIdEnd = libraryIndex % 2 ? ";::@" : "";
+        const std::string genexLibrary = libraryIndex % 3 ? library : "$<LINK_ONLY:" + library + ">";
+
+        evaledValue += separator + directoryIdStart + library + directoryIdEnd;
+        nonEvaledValue += separator + directoryIdStart + genexLibrary + directoryIdEnd;
+    }
+
+    const std::string name = "fixupWithNonEvaled " + std::to_string(evaledValue.size() / 1024) + "KB";
+    runBenchmark(name.c_str(), 20, [&]() {
+        std::pmr::monotonic_buffer_resource memoryResource{};
+        CmagTargetConfig config = {"Debug", {{"LINK_LIBRARIES", evaledValue}}};
+        config.fixupWithNonEvaled("LINK_LIBRARIES", nonEvaledValue, &memoryResource);
+    });
+}
+
+void runLinkLibrariesBenchmarks() {
+    for (size_t librariesCount : {100, 1000, 10000, 100000}) {
+        runLinkLibrariesFixupBenchmark(librariesCount);
+    }
+}
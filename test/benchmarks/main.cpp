@@ -0,0 +1,8 @@
+#include "test/benchmarks/benchmark.h"
+
+int main() {
+    runLinkLibrariesBenchmarks();
+    runReachabilityBenchmarks();
+    runDumpBenchmarks();
+    return 0;
+}
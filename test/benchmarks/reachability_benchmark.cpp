@@ -0,0 +1,88 @@
+#include "cmag_core/core/dependency_reachability.h"
+#include "test/benchmarks/benchmark.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+static CmagDependencyGraph createSyntheticDag(size_t targetsCount, size_t dependenciesPerTarget) {
+    // Targets depend only on targets with higher indices, so the graph is acyclic. Most dependencies are close by, like
+    // libraries of the same component, and some are far away, like common utilities.
+    std::mt19937 random{1234};
+    CmagDependencyGraph graph = {};
+    std::vector<CmagDependencyGraph::Edge> edges = {};
+    for (size_t targetIndex = 0; targetIndex < targetsCount; targetIndex++) {
+        edges.clear();
+        const size_t remainingTargets = targetsCount - targetIndex - 1;
+        for (size_t dependencyIndex = 0; dependencyIndex < dependenciesPerTarget && remainingTargets > 0; dependencyIndex++) {
+            const size_t maxDistance = dependencyIndex == 0 ? remainingTargets : std::min<size_t>(remainingTargets, 50);
+            const size_t distance = 1 + random() % maxDistance;
+            edges.push_back({static_cast<uint32_t>(targetIndex + distance), CmagDependencyType::Build});
+        }
+        graph.addTarget(edges);
+    }
+    graph.finalize();
+    return graph;
+}
+
+static void runReachabilityBenchmark(size_t targetsCount) {
+    const CmagDependencyGraph graph = createSyntheticDag(targetsCount, 4);
+    const std::string suffix = " " + std::to_string(targetsCount / 1000) + "k targets";
+
+    runBenchmark(("reachability create" + suffix).c_str(), 5, [&]() {
+        CmagDependencyReachability reachability{graph, CmagDependencyType::Build};
+    });
+
+    // Compare answering "does A depend on B" with the precomputed bitsets and with a walk over the graph.
+    constexpr size_t queriesCount = 1000;
+    std::mt19937 random{5678};
+    std::vector<std::pair<size_t, size_t>> queries = {};
+    for (size_t queryIndex = 0; queryIndex < queriesCount; queryIndex++) {
+        queries.emplace_back(random() % targetsCount, random() % targetsCount);
+    }
+    const CmagDependencyReachability reachability{graph, CmagDependencyType::Build};
+    size_t positiveAnswers = 0;
+    runBenchmark(("reachability 1000 queries" + suffix).c_str(), 100, [&]() {
+        for (const auto &[src, dst] : queries) {
+            positiveAnswers += reachability.dependsOn(src, dst);
+        }
+    });
+    std::vector<uint32_t> dependents = {};
+    runBenchmark(("graph walk 1000 queries" + suffix).c_str(), 1, [&]() {
+        for (const auto &[src, dst] : queries) {
+            graph.collectTransitiveDependents(dst, CmagDependencyType::Build, dependents);
+            positiveAnswers += std::find(dependents.begin(), dependents.end(), src) != dependents.end();
+        }
+    });
+
+    std::vector<uint32_t> dependencies = {};
+    runBenchmark(("reachability collect all dependencies" + suffix).c_str(), 1000, [&]() {
+        reachability.collectDependencies(random() % targetsCount, dependencies);
+    });
+
+    printf("%-50s %12zu\n", "(positive answers)", positiveAnswers);
+}
+
+static void runReachabilityWalkBenchmark(size_t targetsCount) {
+    // Bitsets of this graph do not fit in memory limits, so queries walk the condensed graph.
+    const CmagDependencyGraph graph = createSyntheticDag(targetsCount, 4);
+    const std::string suffix = " " + std::to_string(targetsCount / 1000) + "k targets";
+    const CmagDependencyReachability reachability{graph, CmagDependencyType::Build};
+
+    std::mt19937 random{5678};
+    size_t positiveAnswers = 0;
+    runBenchmark(("reachability walk 1000 queries" + suffix).c_str(), 1, [&]() {
+        for (size_t queryIndex = 0; queryIndex < 1000; queryIndex++) {
+            positiveAnswers += reachability.dependsOn(random() % targetsCount, random() % targetsCount);
+        }
+    });
+
+    printf("%-50s %12zu (bitsets: %d)\n", "(positive answers)", positiveAnswers, reachability.hasBitsets());
+}
+
+void runReachabilityBenchmarks() {
+    for (size_t targetsCount : {1000, 5000, 20000}) {
+        runReachabilityBenchmark(targetsCount);
+    }
+    runReachabilityWalkBenchmark(50000);
+}
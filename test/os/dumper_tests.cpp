@@ -50,7 +50,7 @@ struct CmagTest : CmagOsTest, testing::WithParamInterface<CMakeGenerator> {
     static void verifyProperty(const CmagTargetConfig &config, const char *name, const char *expectedValue) {
         for (const CmagTargetProperty &prop : config.properties) {
             if (prop.name == name) {
-                EXPECT_STREQ(expectedValue, prop.value.c_str());
+                EXPECT_EQ(std::string_view{expectedValue}, prop.value);
                 return;
             }
         }
@@ -71,7 +71,7 @@ struct CmagTest : CmagOsTest, testing::WithParamInterface<CMakeGenerator> {
 
     static void verifyNoProperty(const CmagTargetConfig &config, const char *name) {
         for (const CmagTargetProperty &prop : config.properties) {
-            EXPECT_STRNE(name, prop.name.c_str());
+            EXPECT_NE(std::string_view{name}, prop.name);
         }
     }
 
@@ -381,6 +381,33 @@ TEST_P(CmagTest, givenProjectWithTargetLinkLibrariesUsedInDifferentDirectoryThan
     }
 }
 
+TEST_P(CmagTest, givenProjectWithManyTargetsThenProcessAllOfThem) {
+    TestWorkspace workspace = TestWorkspace::prepare("many_targets");
+    ASSERT_TRUE(workspace.valid);
+
+    WhiteboxCmagDumper dumper{"project", false, false, workspace.sourcePath, workspace.buildPath, constructCmakeArgs(workspace), ""};
+    {
+        RaiiStdoutCapture capture{};
+        ASSERT_EQ(CmagResult::Success, dumper.dump());
+    }
+
+    const size_t librariesCount = 2000;
+    ASSERT_EQ(librariesCount + 2, dumper.project.getTargets().size());
+    const CmagTarget *lib0 = dumper.project.findTargetByName("Lib0");
+    ASSERT_NE(nullptr, lib0);
+    for (size_t libraryIndex = 1; libraryIndex <= librariesCount; libraryIndex++) {
+        const std::string libraryName = "Lib" + std::to_string(libraryIndex);
+        const CmagTarget *library = dumper.project.findTargetByName(libraryName);
+        ASSERT_NE(nullptr, library) << libraryName;
+        EXPECT_EQ(CmagTargetType::StaticLibrary, library->type);
+        verifyDependenciesForEachConfig(*library, {lib0});
+    }
+
+    const CmagTarget *executable = dumper.project.findTargetByName("Executable");
+    ASSERT_NE(nullptr, executable);
+    verifyPropertyForEachConfig(*executable, "LINK_LIBRARIES", "Lib2000");
+}
+
 TEST_P(CmagTest, givenGeneratorExpressionsInPropertiesThenResolveThemToActualValues) {
     TestWorkspace workspace = TestWorkspace::prepare("genex");
     ASSERT_TRUE(workspace.valid);
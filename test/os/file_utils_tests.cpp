@@ -1,4 +1,5 @@
 #include "cmag_core/utils/file_utils.h"
+#include "cmag_core/utils/mapped_file.h"
 #include "test/os/fixtures.h"
 
 #include <fstream>
@@ -65,3 +66,85 @@ TEST_F(FileUtilsTest, givenNoFileThenReturnEmptyOptional) {
     std::optional<std::string> content = ::readFile(file);
     EXPECT_FALSE(content.has_value());
 }
+
+TEST_F(FileUtilsTest, givenBigFileWhenMappingThenReadItProperly) {
+    TestWorkspace workspace = TestWorkspace::prepareEmpty();
+    ASSERT_TRUE(workspace.valid);
+    const fs::path file = workspace.sourcePath / "file.txt";
+
+    const size_t size = 16 * 1024 * 1024;
+    createDebugFile(file, size);
+
+    MappedFile mappedFile = {};
+    ASSERT_TRUE(mappedFile.open(file));
+    EXPECT_TRUE(mappedFile.isOpen());
+    verifyDebugFileContent(std::string{mappedFile.getContent()}, size);
+
+    MappedFile movedFile = std::move(mappedFile);
+    EXPECT_FALSE(mappedFile.isOpen());
+    EXPECT_TRUE(movedFile.isOpen());
+    EXPECT_EQ(size, movedFile.getContent().size());
+
+    movedFile.close();
+    EXPECT_FALSE(movedFile.isOpen());
+    EXPECT_TRUE(movedFile.getContent().empty());
+}
+
+TEST_F(FileUtilsTest, givenEmptyFileWhenMappingThenReturnEmptyContent) {
+    TestWorkspace workspace = TestWorkspace::prepareEmpty();
+    ASSERT_TRUE(workspace.valid);
+    const fs::path file = workspace.sourcePath / "file.txt";
+    std::ofstream{file, std::ios::out};
+
+    MappedFile mappedFile = {};
+    ASSERT_TRUE(mappedFile.open(file));
+    EXPECT_TRUE(mappedFile.getContent().empty());
+}
+
+TEST_F(FileUtilsTest, givenNoFileWhenMappingThenReturnFalse) {
+    TestWorkspace workspace = TestWorkspace::prepareEmpty();
+    ASSERT_TRUE(workspace.valid);
+    const fs::path file = workspace.sourcePath / "file.txt";
+
+    MappedFile mappedFile = {};
+    EXPECT_FALSE(mappedFile.open(file));
+    EXPECT_FALSE(mappedFile.isOpen());
+}
+
+TEST_F(FileUtilsTest, givenFileWhenViewingThenMapItWithoutCopying) {
+    TestWorkspace workspace = TestWorkspace::prepareEmpty();
+    ASSERT_TRUE(workspace.valid);
+    const fs::path file = workspace.sourcePath / "file.txt";
+
+    const size_t size = 16 * 1024 * 1024;
+    createDebugFile(file, size);
+
+    FileView fileView = {};
+    ASSERT_TRUE(fileView.open(file));
+    EXPECT_TRUE(fileView.isMapped());
+    verifyDebugFileContent(std::string{fileView.getContent()}, size);
+}
+
+TEST_F(FileUtilsTest, givenNoFileWhenViewingThenReturnFalse) {
+    TestWorkspace workspace = TestWorkspace::prepareEmpty();
+    ASSERT_TRUE(workspace.valid);
+    const fs::path file = workspace.sourcePath / "file.txt";
+
+    FileView fileView = {};
+    EXPECT_FALSE(fileView.open(file));
+    EXPECT_FALSE(fileView.isMapped());
+    EXPECT_TRUE(fileView.getContent().empty());
+}
+
+TEST_F(FileUtilsTest, givenFileWhenReadingToBufferThenReplaceBufferContent) {
+    TestWorkspace workspace = TestWorkspace::prepareEmpty();
+    ASSERT_TRUE(workspace.valid);
+    const fs::path file = workspace.sourcePath / "file.txt";
+
+    const size_t size = 100;
+    createDebugFile(file, size);
+
+    std::string buffer = "previous content which is longer than the file, so it has to be shrunk when reading the file";
+    ASSERT_TRUE(readFileToBuffer(file, buffer, std::ios::in | std::ios::binary));
+    verifyDebugFileContent(buffer, size);
+}
@@ -0,0 +1,55 @@
+#include "cmag_core/parse/cmag_project_file.h"
+#include "test/os/fixtures.h"
+
+#include <fstream>
+
+struct ProjectFileTest : CmagOsTest {
+    void SetUp() override {
+        project.getGlobals().cmagVersion = ::cmagVersion;
+        project.getGlobals().listDirs.push_back({"dir", {}});
+        project.addTarget(CmagTarget{
+            "targetA",
+            CmagTargetType::Executable,
+            {
+                {"Debug", {{"LINK_LIBRARIES", "targetB"}, {"prop", "debugValue"}}},
+                {"Release", {{"LINK_LIBRARIES", "targetB"}, {"prop", "releaseValue"}}},
+            },
+            {},
+            {},
+            "dir",
+        });
+        project.addTarget(CmagTarget{"targetB", CmagTargetType::StaticLibrary, {{"Debug", {}}, {"Release", {}}}, {}, {}, "dir"});
+        ASSERT_TRUE(workspace.valid);
+    }
+
+    void writeProjectFile(CmagProjectFormat format) {
+        std::ofstream file{projectFilePath, CmagProjectFile::getOpenMode(format)};
+        CmagProjectFile::writeProject(project, file, format);
+    }
+
+    TestWorkspace workspace = TestWorkspace::prepareEmpty();
+    const fs::path projectFilePath = workspace.sourcePath / "project.cmag-project";
+    CmagProject project = {};
+};
+
+TEST_F(ProjectFileTest, givenLazilyReadBinaryProjectWhenFileIsOverwrittenThenProjectIsStillValid) {
+    writeProjectFile(CmagProjectFormat::Binary);
+
+    CmagProject loadedProject = {};
+    CmagProjectFormat format = {};
+    ASSERT_EQ(ParseResultStatus::Success, CmagProjectFile::readProject(projectFilePath, loadedProject, &format, true).status);
+    EXPECT_EQ(CmagProjectFormat::Binary, format);
+
+    // The browser saves over the same path and the file may be regenerated by cmag at any time.
+    {
+        std::ofstream file{projectFilePath, std::ios::out | std::ios::trunc};
+    }
+
+    const CmagTarget *target = loadedProject.findTargetByName("targetA");
+    ASSERT_NE(nullptr, target);
+    ASSERT_EQ(2u, target->configs.size());
+    EXPECT_EQ("debugValue", target->configs[0].findProperty("prop")->getValue());
+    EXPECT_EQ("releaseValue", target->configs[1].findProperty("prop")->getValue());
+    EXPECT_EQ("targetB", target->configs[1].findProperty(CmagPropertyId::LinkLibraries)->getValue());
+    EXPECT_EQ("targetB", target->configs[0].derived.buildDependencies[0]->name);
+}
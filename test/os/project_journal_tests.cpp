@@ -0,0 +1,124 @@
+#include "cmag_core/browser/project_journal.h"
+#include "cmag_core/parse/cmag_project_file.h"
+#include "test/os/fixtures.h"
+
+#include <fstream>
+
+struct ProjectJournalTest : CmagOsTest {
+    void SetUp() override {
+        project.getGlobals().cmagVersion = ::cmagVersion;
+        project.getGlobals().listDirs.push_back({"dir", {}});
+        project.addTarget(CmagTarget{"targetA", CmagTargetType::Executable, {{"Debug", {}}}, {}, {}, "dir"});
+        project.addTarget(CmagTarget{"targetB", CmagTargetType::Executable, {{"Debug", {}}}, {}, {}, "dir"});
+        ASSERT_TRUE(workspace.valid);
+        writeProjectFile(project);
+    }
+
+    void writeProjectFile(const CmagProject &projectToWrite) {
+        std::ofstream file{projectFilePath, std::ios::out};
+        CmagProjectFile::writeProject(projectToWrite, file, CmagProjectFormat::Json);
+    }
+
+    void readProjectFile(CmagProject &outProject) {
+        ASSERT_EQ(ParseResultStatus::Success, CmagProjectFile::readProject(projectFilePath, outProject).status);
+    }
+
+    TestWorkspace workspace = TestWorkspace::prepareEmpty();
+    const fs::path projectFilePath = workspace.sourcePath / "project.cmag-project";
+    CmagProject project = {};
+};
+
+TEST_F(ProjectJournalTest, givenNoJournalThenReplayDoesNothing) {
+    CmagProject loadedProject = {};
+    readProjectFile(loadedProject);
+    EXPECT_FALSE(ProjectJournal::replay(projectFilePath, loadedProject));
+}
+
+TEST_F(ProjectJournalTest, givenRecordedChangesWhenReplayingThenApplyThemToProject) {
+    CmagTarget &targetB = *project.findTargetByName("targetB");
+    CmagGlobals &globals = project.getGlobals();
+
+    ProjectJournal journal{projectFilePath};
+    targetB.graphical.x = 10.5f;
+    targetB.graphical.y = -3.f;
+    journal.recordTargetPosition(targetB);
+    globals.browser.cameraX = 1.f;
+    globals.browser.cameraY = 2.f;
+    globals.browser.cameraScale = 3.f;
+    journal.recordCamera(globals.browser);
+    ASSERT_TRUE(journal.flush());
+    const size_t sizeAfterFirstFlush = journal.getFileSize();
+    EXPECT_LT(0u, sizeAfterFirstFlush);
+
+    targetB.graphical.x = 11.f;
+    journal.recordTargetPosition(targetB);
+    globals.selectedConfig = "Debug";
+    journal.recordSelectedConfig(globals);
+    globals.browser.selectedTabIndex = 2;
+    journal.recordSelectedTab(globals.browser);
+    globals.browser.displayedDependencyType = CmagDependencyType::Interface;
+    journal.recordDisplayedDependencyType(globals.browser);
+    globals.browser.selectedTargetName = "targetB";
+    journal.recordSelectedTarget(globals.browser);
+    ASSERT_TRUE(journal.flush());
+    EXPECT_LT(sizeAfterFirstFlush, journal.getFileSize());
+
+    CmagProject loadedProject = {};
+    readProjectFile(loadedProject);
+    ASSERT_TRUE(ProjectJournal::replay(projectFilePath, loadedProject));
+    const CmagGlobals &loadedGlobals = loadedProject.getGlobals();
+    EXPECT_EQ(11.f, loadedProject.findTargetByName("targetB")->graphical.x);
+    EXPECT_EQ(-3.f, loadedProject.findTargetByName("targetB")->graphical.y);
+    EXPECT_EQ(0.f, loadedProject.findTargetByName("targetA")->graphical.x);
+    EXPECT_EQ(1.f, loadedGlobals.browser.cameraX);
+    EXPECT_EQ(2.f, loadedGlobals.browser.cameraY);
+    EXPECT_EQ(3.f, loadedGlobals.browser.cameraScale);
+    EXPECT_EQ("Debug", loadedGlobals.selectedConfig);
+    EXPECT_EQ(2, loadedGlobals.browser.selectedTabIndex);
+    EXPECT_EQ(CmagDependencyType::Interface, loadedGlobals.browser.displayedDependencyType);
+    EXPECT_EQ("targetB", loadedGlobals.browser.selectedTargetName);
+}
+
+TEST_F(ProjectJournalTest, givenJournalIsResetThenItIsRemoved) {
+    ProjectJournal journal{projectFilePath};
+    journal.recordCamera(project.getGlobals().browser);
+    ASSERT_TRUE(journal.flush());
+    EXPECT_TRUE(fs::exists(ProjectJournal::getJournalPath(projectFilePath)));
+
+    journal.reset();
+    EXPECT_EQ(0u, journal.getFileSize());
+    EXPECT_FALSE(fs::exists(ProjectJournal::getJournalPath(projectFilePath)));
+}
+
+TEST_F(ProjectJournalTest, givenProjectFileModifiedAfterJournalWhenReplayingThenDiscardJournal) {
+    ProjectJournal journal{projectFilePath};
+    project.findTargetByName("targetA")->graphical.x = 5.f;
+    journal.recordTargetPosition(*project.findTargetByName("targetA"));
+    ASSERT_TRUE(journal.flush());
+
+    project.findTargetByName("targetA")->graphical.x = 0.f;
+    project.getGlobals().cmagProjectName = "somethingElse";
+    writeProjectFile(project);
+
+    CmagProject loadedProject = {};
+    readProjectFile(loadedProject);
+    EXPECT_FALSE(ProjectJournal::replay(projectFilePath, loadedProject));
+    EXPECT_EQ(0.f, loadedProject.findTargetByName("targetA")->graphical.x);
+    EXPECT_FALSE(fs::exists(ProjectJournal::getJournalPath(projectFilePath)));
+}
+
+TEST_F(ProjectJournalTest, givenIncompleteLastEntryWhenReplayingThenIgnoreIt) {
+    ProjectJournal journal{projectFilePath};
+    project.findTargetByName("targetA")->graphical.x = 5.f;
+    journal.recordTargetPosition(*project.findTargetByName("targetA"));
+    ASSERT_TRUE(journal.flush());
+    {
+        std::ofstream file{ProjectJournal::getJournalPath(projectFilePath), std::ios::out | std::ios::app};
+        file << R"({"type":"targetPosition","target":"targetA","x":7.0,)";
+    }
+
+    CmagProject loadedProject = {};
+    readProjectFile(loadedProject);
+    EXPECT_TRUE(ProjectJournal::replay(projectFilePath, loadedProject));
+    EXPECT_EQ(5.f, loadedProject.findTargetByName("targetA")->graphical.x);
+}
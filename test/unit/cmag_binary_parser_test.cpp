@@ -0,0 +1,223 @@
+#include "cmag_core/parse/cmag_binary_parser.h"
+#include "cmag_core/parse/cmag_binary_writer.h"
+#include "cmag_core/parse/cmag_project_file.h"
+
+#include <cstring>
+#include <gtest/gtest.h>
+
+struct CmagBinaryParserTest : ::testing::Test {
+    void SetUp() override {
+        project.getGlobals().cmagVersion = ::cmagVersion;
+        project.getGlobals().listDirs.push_back({"dir", {}});
+        project.addTarget(CmagTarget{
+            "targetA",
+            CmagTargetType::Executable,
+            {
+                {"Debug", {{"prop1", "value"}, {"prop2", "value"}}},
+                {"Release", {{"prop1", "value"}}},
+            },
+            {},
+            {},
+            "dir",
+        });
+        project.addTarget(CmagTarget{
+            "targetB",
+            CmagTargetType::StaticLibrary,
+            {
+                {"Debug", {{"prop1", "otherValue"}}},
+            },
+            {},
+            {},
+            "dir",
+        });
+    }
+
+    std::string writeBinary() const {
+        std::ostringstream stream;
+        CmagBinaryWriter::writeProject(project, stream);
+        return stream.str();
+    }
+
+    static CmagBinaryHeader readHeader(const std::string &data) {
+        CmagBinaryHeader header = {};
+        memcpy(&header, data.data(), sizeof(header));
+        return header;
+    }
+
+    static void writeHeader(std::string &data, const CmagBinaryHeader &header) {
+        memcpy(data.data(), &header, sizeof(header));
+    }
+
+    CmagProject project = {};
+};
+
+TEST_F(CmagBinaryParserTest, givenBinaryProjectThenStringsAreStoredOnce) {
+    const std::string data = writeBinary();
+
+    CmagBinaryProjectView view = {};
+    ASSERT_EQ(ParseResultStatus::Success, view.open(data).status);
+
+    const CmagBinaryProperty *properties = view.getProperties();
+    ASSERT_EQ(4u, view.getHeader().properties.count);
+    EXPECT_EQ("value", view.getString(properties[0].value));
+    EXPECT_EQ(properties[0].value.offset, properties[1].value.offset);
+    EXPECT_EQ(properties[0].value.offset, properties[2].value.offset);
+    EXPECT_EQ(properties[0].name.offset, properties[2].name.offset);
+    EXPECT_EQ("otherValue", view.getString(properties[3].value));
+
+    // Strings are not copied, they point directly into the data
+    const std::string_view targetName = view.getString(view.getTargets()[1].name);
+    EXPECT_EQ("targetB", targetName);
+    EXPECT_GE(targetName.data(), data.data());
+    EXPECT_LT(targetName.data(), data.data() + data.size());
+}
+
+TEST_F(CmagBinaryParserTest, givenProjectFilesThenDetectFormatByContent) {
+    std::ostringstream jsonStream;
+    CmagProjectFile::writeProject(project, jsonStream, CmagProjectFormat::Json);
+    EXPECT_EQ(CmagProjectFormat::Json, CmagProjectFile::detectFormat(jsonStream.str()));
+    EXPECT_EQ(CmagProjectFormat::Binary, CmagProjectFile::detectFormat(writeBinary()));
+    EXPECT_EQ(CmagProjectFormat::Json, CmagProjectFile::detectFormat(""));
+
+    for (CmagProjectFormat format : {CmagProjectFormat::Json, CmagProjectFormat::Binary}) {
+        std::ostringstream stream;
+        CmagProjectFile::writeProject(project, stream, format);
+
+        CmagProject parsedProject = {};
+        CmagProjectFormat parsedFormat = {};
+        ASSERT_EQ(ParseResultStatus::Success, CmagProjectFile::parseProject(stream.str(), parsedProject, &parsedFormat).status);
+        EXPECT_EQ(format, parsedFormat);
+        ASSERT_EQ(2u, parsedProject.getTargets().size());
+        ASSERT_NE(nullptr, parsedProject.findTargetByName("targetB"));
+        EXPECT_EQ(CmagTargetType::StaticLibrary, parsedProject.findTargetByName("targetB")->type);
+    }
+}
+
+TEST_F(CmagBinaryParserTest, givenProjectFilePathThenReturnPathForOtherFormat) {
+    EXPECT_EQ(fs::path{"dir/a.cmag-project-bin"}, CmagProjectFile::getPathForFormat("dir/a.cmag-project", CmagProjectFormat::Binary));
+    EXPECT_EQ(fs::path{"dir/a.cmag-project"}, CmagProjectFile::getPathForFormat("dir/a.cmag-project-bin", CmagProjectFormat::Json));
+    EXPECT_EQ(fs::path{"dir/a.cmag-project"}, CmagProjectFile::getPathForFormat("dir/a.cmag-project", CmagProjectFormat::Json));
+    EXPECT_EQ(fs::path{"dir/a.txt.cmag-project-bin"}, CmagProjectFile::getPathForFormat("dir/a.txt", CmagProjectFormat::Binary));
+}
+
+TEST_F(CmagBinaryParserTest, givenTruncatedDataThenReturnError) {
+    const std::string data = writeBinary();
+    for (size_t size : {size_t{4}, sizeof(CmagBinaryHeader) - 1, sizeof(CmagBinaryHeader), data.size() - 1}) {
+        CmagProject parsedProject = {};
+        const ParseResult result = CmagBinaryParser::parseProject(std::string_view{data}.substr(0, size), parsedProject);
+        EXPECT_EQ(ParseResultStatus::Malformed, result.status) << "size=" << size;
+    }
+}
+
+TEST_F(CmagBinaryParserTest, givenInvalidStringReferenceThenReturnError) {
+    std::string data = writeBinary();
+    const CmagBinaryHeader header = readHeader(data);
+
+    CmagBinaryTarget target = {};
+    memcpy(&target, data.data() + header.targets.offset, sizeof(target));
+    target.name.length = header.strings.count + 1;
+    memcpy(data.data() + header.targets.offset, &target, sizeof(target));
+
+    CmagProject parsedProject = {};
+    const ParseResult result = CmagBinaryParser::parseProject(data, parsedProject);
+    EXPECT_EQ(ParseResultStatus::InvalidValue, result.status);
+    EXPECT_STREQ("Invalid string reference in binary project file", result.errorMessage.c_str());
+}
+
+TEST_F(CmagBinaryParserTest, givenInvalidRecordRangeThenReturnError) {
+    std::string data = writeBinary();
+    const CmagBinaryHeader header = readHeader(data);
+
+    CmagBinaryConfig config = {};
+    memcpy(&config, data.data() + header.configs.offset, sizeof(config));
+    config.properties.first = header.properties.count;
+    memcpy(data.data() + header.configs.offset, &config, sizeof(config));
+
+    CmagProject parsedProject = {};
+    const ParseResult result = CmagBinaryParser::parseProject(data, parsedProject);
+    EXPECT_EQ(ParseResultStatus::InvalidValue, result.status);
+    EXPECT_STREQ("Invalid record range in binary project file", result.errorMessage.c_str());
+}
+
+TEST_F(CmagBinaryParserTest, givenInvalidDisplayedDependencyTypeThenReturnError) {
+    std::string data = writeBinary();
+    const CmagBinaryHeader header = readHeader(data);
+
+    CmagBinaryGlobals globals = {};
+    memcpy(&globals, data.data() + header.globals.offset, sizeof(globals));
+    globals.displayedDependencyType = static_cast<uint32_t>(CmagDependencyType::Build | CmagDependencyType::Interface | CmagDependencyType::Additional);
+    memcpy(data.data() + header.globals.offset, &globals, sizeof(globals));
+    {
+        CmagProject parsedProject = {};
+        ASSERT_EQ(ParseResultStatus::Success, CmagBinaryParser::parseProject(data, parsedProject).status);
+        EXPECT_EQ(CmagDependencyType::Build | CmagDependencyType::Interface | CmagDependencyType::Additional, parsedProject.getGlobals().browser.displayedDependencyType);
+    }
+
+    globals.displayedDependencyType = 8;
+    memcpy(data.data() + header.globals.offset, &globals, sizeof(globals));
+    {
+        CmagProject parsedProject = {};
+        const ParseResult result = CmagBinaryParser::parseProject(data, parsedProject);
+        EXPECT_EQ(ParseResultStatus::InvalidValue, result.status);
+        EXPECT_STREQ("Invalid displayed dependency type in binary project file", result.errorMessage.c_str());
+    }
+}
+
+TEST_F(CmagBinaryParserTest, givenDifferentFormatVersionThenReturnError) {
+    std::string data = writeBinary();
+    CmagBinaryHeader header = readHeader(data);
+    header.formatVersion++;
+    writeHeader(data, header);
+
+    CmagProject parsedProject = {};
+    const ParseResult result = CmagBinaryParser::parseProject(data, parsedProject);
+    EXPECT_EQ(ParseResultStatus::VersionMismatch, result.status);
+}
+
+TEST_F(CmagBinaryParserTest, givenIncompatibleCmagVersionThenReturnError) {
+    CmagVersion version = ::cmagVersion;
+    version.comp1++;
+    project.getGlobals().cmagVersion = version;
+    const std::string data = writeBinary();
+
+    CmagProject parsedProject = {};
+    const ParseResult result = CmagBinaryParser::parseProject(data, parsedProject);
+    EXPECT_EQ(ParseResultStatus::VersionMismatch, result.status);
+}
+
+TEST_F(CmagBinaryParserTest, givenLazyPropertyValuesWhenParsingThenEqualValuesShareStorage) {
+    project.addTarget(CmagTarget{
+        "targetC",
+        CmagTargetType::Executable,
+        {
+            {"Debug", {{"LINK_LIBRARIES", "targetB"}, {"prop1", "value"}, {"prop2", ""}}},
+            {"Release", {{"LINK_LIBRARIES", "targetB"}, {"prop1", "otherValue"}, {"prop2", ""}}},
+        },
+        {},
+        {},
+        "dir",
+    });
+    std::string data = writeBinary();
+
+    CmagProject parsedProject = {};
+    ASSERT_EQ(ParseResultStatus::Success, CmagBinaryParser::parseProject(data, parsedProject, true).status);
+    data.assign(data.size(), '\0'); // raw values must not point to the parsed data
+
+    const CmagTarget *target = parsedProject.findTargetByName("targetC");
+    ASSERT_NE(nullptr, target);
+    const CmagTargetConfig &debugConfig = target->configs[0];
+    const CmagTargetConfig &releaseConfig = target->configs[1];
+    EXPECT_EQ("targetB", debugConfig.properties[0].getValue());
+    EXPECT_EQ(debugConfig.properties[0].valueId, releaseConfig.properties[0].valueId);
+    EXPECT_EQ(debugConfig.properties[0].getValue().data(), releaseConfig.properties[0].getValue().data());
+    EXPECT_EQ("value", debugConfig.properties[1].getValue());
+    EXPECT_EQ("otherValue", releaseConfig.properties[1].getValue());
+    EXPECT_EQ("", debugConfig.properties[2].getValue());
+    EXPECT_EQ(CmagPropertyValueId::Empty, debugConfig.properties[2].valueId);
+
+    EXPECT_TRUE(debugConfig.properties[0].isConsistent);
+    EXPECT_FALSE(debugConfig.properties[1].isConsistent);
+    EXPECT_TRUE(debugConfig.properties[2].isConsistent);
+    ASSERT_EQ(1u, debugConfig.derived.buildDependencies.size());
+    EXPECT_EQ("targetB", debugConfig.derived.buildDependencies[0]->name);
+}
@@ -59,8 +59,8 @@ void compareTargetProperties(const CmagTargetConfig &expected, const CmagTargetC
     // Properties
     ASSERT_EQ(expected.properties.size(), actual.properties.size());
     for (size_t i = 0u; i < expected.properties.size(); i++) {
-        EXPECT_STREQ(expected.properties[i].name.c_str(), actual.properties[i].name.c_str());
-        EXPECT_STREQ(expected.properties[i].value.c_str(), actual.properties[i].value.c_str());
+        EXPECT_EQ(expected.properties[i].name, actual.properties[i].name);
+        EXPECT_EQ(expected.properties[i].value, actual.properties[i].value);
     }
 }
 
@@ -478,6 +478,204 @@ TEST_F(CmagProjectParseTest, givenTargetWithEmptyNameThenReturnError) {
     ASSERT_EQ(ParseResultStatus::InvalidValue, CmagJsonParser::parseProject(json, project).status);
 }
 
+TEST_F(CmagProjectParseTest, givenInvalidTargetAndMalformedFileThenReturnMalformedError) {
+    const char *json = insertGlobals(R"DELIMETER(
+    {
+        "globals": %s,
+        "targets" : {
+            "myTarget" : {
+                "type": "exe",
+                "configs": {}
+            }
+        }
+    )DELIMETER");
+    CmagProject project{};
+    const ParseResult result = CmagJsonParser::parseProject(json, project);
+    EXPECT_EQ(ParseResultStatus::Malformed, result.status);
+    EXPECT_STREQ("File is malformed", result.errorMessage.c_str());
+}
+
+TEST_F(CmagProjectParseTest, givenNonObjectNodesThenReturnErrors) {
+    {
+        CmagProject project{};
+        const ParseResult result = CmagJsonParser::parseProject("[1, 2]", project);
+        EXPECT_EQ(ParseResultStatus::InvalidNodeType, result.status);
+        EXPECT_STREQ("Root node should be an object", result.errorMessage.c_str());
+    }
+    {
+        CmagProject project{};
+        const ParseResult result = CmagJsonParser::parseProject("{ \"targets\": {} }", project);
+        EXPECT_EQ(ParseResultStatus::MissingField, result.status);
+        EXPECT_STREQ("Could not find cmag version", result.errorMessage.c_str());
+    }
+    {
+        const char *json = insertGlobals(R"DELIMETER({ "globals": %s, "targets": [ {} ] })DELIMETER");
+        CmagProject project{};
+        const ParseResult result = CmagJsonParser::parseProject(json, project);
+        EXPECT_EQ(ParseResultStatus::InvalidNodeType, result.status);
+        EXPECT_STREQ("Targets node should be an object", result.errorMessage.c_str());
+    }
+    {
+        const char *json = insertGlobals(R"DELIMETER({ "globals": %s })DELIMETER");
+        CmagProject project{};
+        const ParseResult result = CmagJsonParser::parseProject(json, project);
+        EXPECT_EQ(ParseResultStatus::MissingField, result.status);
+        EXPECT_STREQ("Missing targets node", result.errorMessage.c_str());
+    }
+}
+
+TEST_F(CmagProjectParseTest, givenMultipleInvalidTargetsThenReturnErrorOfFirstTargetInAlphabeticalOrder) {
+    const char *json = insertGlobals(R"DELIMETER(
+    {
+        "targets" : {
+            "targetB" : {
+                "type": "EXECUTABLE",
+                "configs": {}
+            },
+            "targetA" : {
+                "type": "exe"
+            }
+        },
+        "globals": %s
+    }
+    )DELIMETER");
+    CmagProject project{};
+    const ParseResult result = CmagJsonParser::parseProject(json, project);
+    EXPECT_EQ(ParseResultStatus::InvalidValue, result.status);
+    EXPECT_STREQ("Invalid type specified for target targetA\n", result.errorMessage.c_str());
+}
+
+TEST_F(CmagProjectParseTest, givenTargetsBeforeGlobalsAndDuplicatedTargetThenParseCorrectly) {
+    const char *json = insertGlobals(R"DELIMETER(
+    {
+        "targets" : {
+            "targetB" : {
+                "type": "EXECUTABLE",
+                "configs": {}
+            },
+            "targetA" : {
+                "type": "EXECUTABLE",
+                "configs": { "Debug" : { "LINK_LIBRARIES": "targetB", "nested": "[{}]" } },
+                "graphical": { "x": 1.5, "y": -2, "hideConnections": false },
+                "listDir": "a",
+                "isImported": false,
+                "aliases": [ "alias" ]
+            },
+            "targetB" : {
+                "type": "STATIC_LIBRARY",
+                "configs": { "Debug" : {} },
+                "graphical": { "x": 0, "y": 0, "hideConnections": true },
+                "listDir": "a",
+                "isImported": true,
+                "aliases": []
+            }
+        },
+        "unknownField": [ { "a": [ 1, 2 ] }, null ],
+        "globals": %s
+    }
+    )DELIMETER");
+    CmagProject project{};
+    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseProject(json, project).status);
+
+    const std::vector<CmagTarget> &targets = project.getTargets();
+    ASSERT_EQ(2u, targets.size());
+    EXPECT_STREQ("targetA", targets[0].name.c_str());
+    EXPECT_EQ(1.5f, targets[0].graphical.x);
+    EXPECT_EQ(-2.f, targets[0].graphical.y);
+    EXPECT_EQ((std::vector<std::string>{"alias"}), targets[0].aliases);
+    EXPECT_EQ("[{}]", targets[0].configs[0].properties[1].value);
+    EXPECT_EQ((std::vector<const CmagTarget *>{&targets[1]}), targets[0].configs[0].derived.buildDependencies);
+    EXPECT_STREQ("targetB", targets[1].name.c_str());
+    EXPECT_EQ(CmagTargetType::StaticLibrary, targets[1].type);
+    EXPECT_TRUE(targets[1].graphical.hideConnections);
+}
+
+TEST_F(CmagProjectParseTest, givenUnsortedAndDuplicatedKeysInTargetThenSortThemAndKeepLastValues) {
+    // The second variant has duplicated targets node, which is parsed by the sequential parser.
+    for (const char *duplicatedTargets : {"", R"("targets": [],)"}) {
+        const char *json = insertGlobals(R"DELIMETER(
+        {
+            "globals": %s,
+            %s
+            "targets" : {
+                "myTarget" : {
+                    "aliases": [ 1 ],
+                    "configs": {
+                        "Release": { "c": "1", "a": "2", "b": [ "x" ], "a": "3", "b": "4" },
+                        "Debug": { "a": "x" },
+                        "Debug": { "b": "5" }
+                    },
+                    "graphical": { "x": 1, "y": 2, "hideConnections": false, "x": 3 },
+                    "listDir": "a",
+                    "isImported": false,
+                    "type": "EXECUTABLE",
+                    "aliases": [ "alias" ]
+                }
+            }
+        }
+        )DELIMETER",
+                                         cmagVersion,
+                                         duplicatedTargets);
+        CmagProject project{};
+        ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseProject(json, project).status);
+
+        ASSERT_EQ(1u, project.getTargets().size());
+        const CmagTarget &target = project.getTargets()[0];
+        EXPECT_EQ(3.f, target.graphical.x);
+        EXPECT_EQ((std::vector<std::string>{"alias"}), target.aliases);
+        ASSERT_EQ(2u, target.configs.size());
+        compareTargetProperties(CmagTargetConfig{"Debug", {{"b", "5"}}}, target.configs[0]);
+        compareTargetProperties(CmagTargetConfig{"Release", {{"a", "3"}, {"b", "4"}, {"c", "1"}}}, target.configs[1]);
+    }
+}
+
+TEST_F(CmagProjectParseTest, givenManyTargetsThenParseThemConcurrentlyInTheSameWay) {
+    // Enough targets to be split into multiple chunks. Targets are written in reverse order and the last one is
+    // duplicated at the end, so the duplicate from the last chunk has to win.
+    constexpr size_t targetsCount = 2000;
+    auto getTargetName = [](size_t targetIndex) {
+        std::string result = std::to_string(targetIndex);
+        return "target" + std::string(4 - result.size(), '0') + result;
+    };
+    auto writeTarget = [&](std::string &json, size_t targetIndex, const char *type) {
+        const std::string linkLibraries = targetIndex > 0 ? getTargetName(targetIndex - 1) : "";
+        json += "\"" + getTargetName(targetIndex) + "\": {";
+        json += "\"type\": \"" + std::string{type} + "\", \"listDir\": \"a\", \"isImported\": false, \"aliases\": [],";
+        json += "\"graphical\": { \"x\": 0, \"y\": 0, \"hideConnections\": false },";
+        json += "\"configs\": { \"Debug\": { \"LINK_LIBRARIES\": \"" + linkLibraries + R"(", "OTHER": "{[\"]}" } } })";
+    };
+    std::string targetsJson = {};
+    for (size_t targetIndex = targetsCount; targetIndex-- > 0;) {
+        writeTarget(targetsJson, targetIndex, "EXECUTABLE");
+        targetsJson += ",\n";
+    }
+    writeTarget(targetsJson, targetsCount - 1, "STATIC_LIBRARY");
+
+    CmagVersion version = ::cmagVersion;
+    const std::string globals = constructGlobals(version);
+    const std::string json = "{ \"globals\": " + globals + ", \"targets\": {" + targetsJson + "} }";
+    CmagProject project{};
+    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseProject(json, project).status);
+
+    const std::vector<CmagTarget> &targets = project.getTargets();
+    ASSERT_EQ(targetsCount, targets.size());
+    for (size_t targetIndex = 0; targetIndex < targetsCount; targetIndex++) {
+        EXPECT_EQ(getTargetName(targetIndex), targets[targetIndex].name);
+        ASSERT_EQ(2u, targets[targetIndex].configs[0].properties.size());
+        EXPECT_EQ("{[\"]}", targets[targetIndex].configs[0].properties[1].value);
+        if (targetIndex > 0) {
+            EXPECT_EQ((std::vector<const CmagTarget *>{&targets[targetIndex - 1]}), targets[targetIndex].configs[0].derived.buildDependencies);
+        }
+    }
+    EXPECT_EQ(CmagTargetType::Executable, targets.front().type);
+    EXPECT_EQ(CmagTargetType::StaticLibrary, targets.back().type);
+
+    // A malformed target is reported as a malformed file, even if other targets are invalid.
+    const std::string malformedJson = "{ \"globals\": " + globals + ", \"targets\": {" + targetsJson + R"(, "x": {"type": "exe"}, "y": {"type" 1} } })";
+    CmagProject malformedProject{};
+    EXPECT_EQ(ParseResultStatus::Malformed, CmagJsonParser::parseProject(malformedJson, malformedProject).status);
+}
+
 TEST(CmagTargetsFilesListFileParseTest, givenEmptyConfigsListThenParseCorrectly) {
     const char *json = R"DELIMETER(
     []
@@ -588,8 +786,9 @@ TEST(CmagTargetsFileParseTest, givenNoTargetsThenParseCorrectly) {
     {
     }
     )DELIMETER";
+    std::pmr::monotonic_buffer_resource memoryResource{};
     std::vector<CmagTarget> targets{};
-    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseTargetsFile(json, targets).status);
+    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseTargetsFile(json, targets, &memoryResource).status);
     ASSERT_EQ(0u, targets.size());
 }
 
@@ -602,8 +801,9 @@ TEST(CmagTargetsFileParseTest, givenTargetWithNoConfigsThenReturnError) {
         }
     }
     )DELIMETER";
+    std::pmr::monotonic_buffer_resource memoryResource{};
     std::vector<CmagTarget> targets{};
-    ASSERT_EQ(ParseResultStatus::MissingField, CmagJsonParser::parseTargetsFile(json, targets).status);
+    ASSERT_EQ(ParseResultStatus::MissingField, CmagJsonParser::parseTargetsFile(json, targets, &memoryResource).status);
 }
 
 TEST(CmagTargetsFileParseTest, givenTargetWithNoPropertesThenParseCorrectly) {
@@ -624,8 +824,9 @@ TEST(CmagTargetsFileParseTest, givenTargetWithNoPropertesThenParseCorrectly) {
         }
     }
     )DELIMETER";
+    std::pmr::monotonic_buffer_resource memoryResource{};
     std::vector<CmagTarget> targets{};
-    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseTargetsFile(json, targets).status);
+    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseTargetsFile(json, targets, &memoryResource).status);
     ASSERT_EQ(1u, targets.size());
 
     const CmagTarget &target = targets[0];
@@ -663,8 +864,9 @@ TEST(CmagTargetsFileParseTest, givenTargetWithNonGenexablePropertesThenParseCorr
         }
     }
     )DELIMETER";
+    std::pmr::monotonic_buffer_resource memoryResource{};
     std::vector<CmagTarget> targets{};
-    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseTargetsFile(json, targets).status);
+    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseTargetsFile(json, targets, &memoryResource).status);
     ASSERT_EQ(1u, targets.size());
 
     const CmagTarget &target = targets[0];
@@ -719,8 +921,9 @@ TEST(CmagTargetsFileParseTest, givenMultipleTargetsThenParseCorrectly) {
         }
     }
     )DELIMETER";
+    std::pmr::monotonic_buffer_resource memoryResource{};
     std::vector<CmagTarget> targets{};
-    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseTargetsFile(json, targets).status);
+    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseTargetsFile(json, targets, &memoryResource).status);
     ASSERT_EQ(2u, targets.size());
 
     {
@@ -779,8 +982,9 @@ TEST(CmagTargetsFileParseTest, givenTargetWithGenexablePropertesThenParseCorrect
         }
     }
     )DELIMETER";
+    std::pmr::monotonic_buffer_resource memoryResource{};
     std::vector<CmagTarget> targets{};
-    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseTargetsFile(json, targets).status);
+    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseTargetsFile(json, targets, &memoryResource).status);
     ASSERT_EQ(1u, targets.size());
 
     const CmagTarget &target = targets[0];
@@ -822,8 +1026,9 @@ TEST(CmagTargetsFileParseTest, givenTargetWithLinkOnlyGenexPropertesThenParseAnd
         }
     }
     )DELIMETER";
+    std::pmr::monotonic_buffer_resource memoryResource{};
     std::vector<CmagTarget> targets{};
-    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseTargetsFile(json, targets).status);
+    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseTargetsFile(json, targets, &memoryResource).status);
     ASSERT_EQ(1u, targets.size());
 
     const CmagTarget &target = targets[0];
@@ -841,6 +1046,61 @@ TEST(CmagTargetsFileParseTest, givenTargetWithLinkOnlyGenexPropertesThenParseAnd
     compareTargetProperties(expectedProperties, target.configs[0]);
 }
 
+TEST(CmagTargetsFileParseTest, givenManyTargetsWithRawStringsThenParseThemConcurrentlyInTheSameWay) {
+    constexpr size_t targetsCount = 1000;
+    std::string json = "{";
+    for (size_t targetIndex = 0; targetIndex < targetsCount; targetIndex++) {
+        if (targetIndex > 0) {
+            json += ",\n";
+        }
+        json += "'''target" + std::to_string(targetIndex) + R"DELIMETER(''': {
+            "type": "EXECUTABLE",
+            "configs": {
+                "Debug": {
+                    "non_genexable": { "raw": '''a "quoted" {value}''' },
+                    "genexable": { "LINK_LIBRARIES": '''$<$<CONFIG:Debug>:lib>;other''' },
+                    "genexable_evaled": { "LINK_LIBRARIES": '''lib;other''' }
+                }
+            },
+            "listDir" : "a",
+            "isImported": false,
+            "aliases": []
+        })DELIMETER";
+    }
+    json += "}";
+
+    std::pmr::monotonic_buffer_resource memoryResource{};
+    std::vector<CmagTarget> targets{};
+    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseTargetsFile(json, targets, &memoryResource).status);
+    ASSERT_EQ(targetsCount, targets.size());
+    EXPECT_STREQ("target0", targets[0].name.c_str());
+    EXPECT_STREQ("target1", targets[1].name.c_str());
+    EXPECT_STREQ("target10", targets[2].name.c_str()); // sorted by name, just like in a DOM
+    CmagTargetConfig expectedProperties = {
+        "Debug",
+        {
+            {"raw", "a \"quoted\" {value}"},
+            {"LINK_LIBRARIES", "lib;other"},
+        },
+    };
+    for (const CmagTarget &target : targets) {
+        ASSERT_EQ(1u, target.configs.size());
+        compareTargetProperties(expectedProperties, target.configs[0]);
+    }
+
+    std::vector<CmagTarget> singleThreadedTargets{};
+    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseTargetsFile(json, singleThreadedTargets, &memoryResource, false).status);
+    ASSERT_EQ(targetsCount, singleThreadedTargets.size());
+    for (size_t targetIndex = 0; targetIndex < targetsCount; targetIndex++) {
+        EXPECT_EQ(targets[targetIndex].name, singleThreadedTargets[targetIndex].name);
+        compareTargetProperties(targets[targetIndex].configs[0], singleThreadedTargets[targetIndex].configs[0]);
+    }
+
+    json.insert(json.size() - 1, ", 'malformed': {}");
+    targets.clear();
+    EXPECT_EQ(ParseResultStatus::Malformed, CmagJsonParser::parseTargetsFile(json, targets, &memoryResource).status);
+}
+
 TEST(CmagAliasesFileParseTest, givenEmptyAliasesListThenReturnEmptyList) {
     const char *json = R"DELIMETER(
     {}
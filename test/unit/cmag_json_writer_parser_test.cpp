@@ -1,5 +1,8 @@
+#include "cmag_core/parse/cmag_binary_parser.h"
+#include "cmag_core/parse/cmag_binary_writer.h"
 #include "cmag_core/parse/cmag_json_parser.h"
 #include "cmag_core/parse/cmag_json_writer.h"
+#include "cmag_core/parse/cmag_project_file.h"
 
 #include <gtest/gtest.h>
 
@@ -15,18 +18,42 @@ struct CmagWriterParserTest : ::testing::Test {
     }
 
     static void verify(const CmagProject &initialProject) {
+        verifyJson(initialProject, false);
+        verifyJson(initialProject, true);
+        verifyBinary(initialProject);
+    }
+
+    static void verifyJson(const CmagProject &initialProject, bool compact) {
         std::ostringstream jsonStream;
-        CmagJsonWriter::writeProject(initialProject, jsonStream);
+        CmagJsonWriter::writeProject(initialProject, jsonStream, compact);
         std::string json = jsonStream.str();
 
-        CmagProject derivedProject{};
-        const auto parseResult = CmagJsonParser::parseProject(json, derivedProject);
-        if (parseResult.status != ParseResultStatus::Success && parseResult.status != ParseResultStatus::DataDerivationFailed) {
-            // We can allow data derivation failure, since it's not important here
-            ASSERT_EQ(ParseResultStatus::Success, parseResult.status);
+        for (bool lazyPropertyValues : {false, true}) {
+            CmagProject derivedProject{};
+            const auto parseResult = CmagJsonParser::parseProject(json, derivedProject, lazyPropertyValues);
+            if (parseResult.status != ParseResultStatus::Success && parseResult.status != ParseResultStatus::DataDerivationFailed) {
+                // We can allow data derivation failure, since it's not important here
+                ASSERT_EQ(ParseResultStatus::Success, parseResult.status);
+            }
+
+            compareProjects(initialProject, derivedProject);
         }
+    }
 
-        compareProjects(initialProject, derivedProject);
+    static void verifyBinary(const CmagProject &initialProject) {
+        std::ostringstream binaryStream;
+        CmagBinaryWriter::writeProject(initialProject, binaryStream);
+        std::string binary = binaryStream.str();
+
+        for (bool lazyPropertyValues : {false, true}) {
+            CmagProject derivedProject{};
+            const auto parseResult = CmagBinaryParser::parseProject(binary, derivedProject, lazyPropertyValues);
+            if (parseResult.status != ParseResultStatus::Success && parseResult.status != ParseResultStatus::DataDerivationFailed) {
+                ASSERT_EQ(ParseResultStatus::Success, parseResult.status);
+            }
+
+            compareProjects(initialProject, derivedProject);
+        }
     }
 
     static void compareProjects(const CmagProject &exp, const CmagProject &act) {
@@ -98,7 +125,7 @@ struct CmagWriterParserTest : ::testing::Test {
                     const auto &expProperty = expPropertiesForConfig.properties[k];
                     const auto &actProperty = actPropertiesForConfig.properties[k];
                     EXPECT_EQ(expProperty.name, actProperty.name);
-                    EXPECT_EQ(expProperty.value, actProperty.value);
+                    EXPECT_EQ(expProperty.getValue(), actProperty.getValue());
                 }
             }
 
@@ -188,6 +215,39 @@ TEST_F(CmagWriterParserTest, givenProjectWithTargetWithPropertiesThenWriteAndRea
     verify(project);
 }
 
+TEST_F(CmagWriterParserTest, givenLazyPropertyValuesWhenParsingJsonThenUnescapedValuesAreViewsIntoStoredJson) {
+    project.getGlobals().listDirs = {CmagListDir{"dir", {}}};
+    project.addTarget(CmagTarget{
+        "myTarget",
+        CmagTargetType::Executable,
+        {
+            {"Debug", {{"plain", "lib1;lib2"}, {"escaped", "a \"quoted\" C:\\path"}, {"empty", ""}}},
+            {"Release", {{"plain", "lib1;lib2"}, {"escaped", "a \"quoted\" C:\\path"}, {"empty", ""}}},
+        },
+        {},
+        {},
+        "dir",
+    });
+    std::ostringstream jsonStream;
+    CmagJsonWriter::writeProject(project, jsonStream);
+    std::string json = jsonStream.str();
+
+    CmagProject parsedProject{};
+    ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseProject(json, parsedProject, true).status);
+    json.assign(json.size(), '\0'); // values must not point to the parsed data
+
+    const CmagTarget *target = parsedProject.findTargetByName("myTarget");
+    ASSERT_NE(nullptr, target);
+    const CmagTargetProperty &plain = *target->configs[0].findProperty("plain");
+    const CmagTargetProperty &escaped = *target->configs[0].findProperty("escaped");
+    EXPECT_EQ("lib1;lib2", plain.getValue());
+    EXPECT_EQ('"', plain.getValue().data()[-1]); // still surrounded by the quotes of the stored json
+    EXPECT_EQ(plain.getValue().data(), target->configs[1].findProperty("plain")->getValue().data());
+    EXPECT_EQ("a \"quoted\" C:\\path", escaped.getValue());
+    EXPECT_EQ(escaped.valueId, target->configs[1].findProperty("escaped")->valueId);
+    EXPECT_EQ(CmagPropertyValueId::Empty, target->configs[0].findProperty("empty")->valueId);
+}
+
 TEST_F(CmagWriterParserTest, givenProjectWithTargetWithMultipleConfigsThenWriteAndReadCorrectly) {
     project.addTarget(CmagTarget{
         "myTarget",
@@ -321,3 +381,124 @@ TEST_F(CmagWriterParserTest, givenProjectWithSetGlobalsThenWriteAndReadCorrectly
     };
     verify(project);
 }
+
+TEST_F(CmagWriterParserTest, givenBigProjectWhenParsingThenPropertiesAreAllocatedWithFewUpstreamAllocations) {
+    struct CountingMemoryResource : std::pmr::memory_resource {
+        size_t allocationsCount = 0;
+
+        void *do_allocate(size_t bytes, size_t alignment) override {
+            allocationsCount++;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void *p, size_t bytes, size_t alignment) override {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    // Long names and values, so they don't fit into small string optimization buffers. Indices are padded
+    // to preserve alphabetical order.
+    auto toPaddedString = [](size_t index) {
+        std::string result = std::to_string(index);
+        return std::string(3 - result.size(), '0') + result;
+    };
+    const size_t targetsCount = 100;
+    const size_t propertiesCount = 50;
+    std::vector<std::string> names = {};
+    for (size_t propertyIndex = 0; propertyIndex < propertiesCount; propertyIndex++) {
+        names.push_back("SOME_LONG_PROPERTY_NAME_" + toPaddedString(propertyIndex));
+    }
+    project.getGlobals().listDirs = {CmagListDir{"a", {}}};
+    for (size_t targetIndex = 0; targetIndex < targetsCount; targetIndex++) {
+        CmagTarget target{"target" + toPaddedString(targetIndex), CmagTargetType::StaticLibrary, {{"Debug", {}}}, {}};
+        target.listDirName = "a";
+        const std::string value = "some long property value of " + target.name;
+        for (const std::string &name : names) {
+            target.configs[0].properties.push_back(CmagTargetProperty{name, value});
+        }
+        ASSERT_TRUE(project.addTarget(std::move(target)));
+    }
+    std::ostringstream jsonStream;
+    CmagJsonWriter::writeProject(project, jsonStream);
+
+    CountingMemoryResource countingMemoryResource = {};
+    {
+        CmagProject parsedProject{&countingMemoryResource};
+        ASSERT_EQ(ParseResultStatus::Success, CmagJsonParser::parseProject(jsonStream.str(), parsedProject).status);
+        compareProjects(project, parsedProject);
+    }
+
+    const size_t stringsCount = targetsCount * propertiesCount * 2;
+    RecordProperty("stringsCount", static_cast<int>(stringsCount));
+    RecordProperty("upstreamAllocationsCount", static_cast<int>(countingMemoryResource.allocationsCount));
+    EXPECT_LT(countingMemoryResource.allocationsCount, 32u);
+}
+
+TEST_F(CmagWriterParserTest, givenProjectWhenWritingJsonThenOutputIsTheSameAsDumpOfJsonDom) {
+    project.getGlobals().cmakeVersion = "3.28\t\"quoted\" \\ \x01\x1f";
+    project.getGlobals().browser.cameraX = 25.3f;
+    project.getGlobals().browser.cameraY = -0.001f;
+    project.getGlobals().browser.cameraScale = 1e20f;
+    project.getGlobals().browser.displayedDependencyType = CmagDependencyType::DEFAULT;
+    project.getGlobals().listDirs = {CmagListDir{"b", {1}}, CmagListDir{"a", {}}};
+    project.addTarget(CmagTarget{
+        "targetB",
+        CmagTargetType::SharedLibrary,
+        {
+            {"Release", {{"propZ", "z"}, {"propA", "a\nb"}}},
+            {"Debug", {{"propA", "a"}, {"propA", "overwritten"}, {"propB", ""}}},
+        },
+        {12.f, 0.1f, true},
+    });
+    CmagTarget targetA{"targetA", CmagTargetType::Utility, {{"Debug", {}}}, {}};
+    targetA.aliases = {"aliasB", "aliasA"};
+    targetA.isImported = true;
+    project.addTarget(std::move(targetA));
+
+    for (bool compact : {false, true}) {
+        std::ostringstream jsonStream;
+        CmagJsonWriter::writeProject(project, jsonStream, compact);
+        const std::string json = jsonStream.str();
+
+        const nlohmann::json dom = nlohmann::json::parse(json);
+        const std::string expectedJson = compact ? dom.dump() : dom.dump(4);
+        EXPECT_EQ(expectedJson, json);
+    }
+}
+
+TEST_F(CmagWriterParserTest, givenBrowserStateSnapshotWhenProjectIsModifiedThenWriteStateFromSnapshot) {
+    project.getGlobals().selectedConfig = "Debug";
+    project.getGlobals().browser.cameraX = 4.f;
+    project.getGlobals().browser.selectedTargetName = "myTarget";
+    project.addTarget(CmagTarget{"myTarget", CmagTargetType::Executable, {{"Debug", {}}}, {12.f, 25.f, true}});
+    const CmagBrowserStateSnapshot snapshot = project.createBrowserStateSnapshot();
+
+    project.getGlobals().darkMode = true;
+    project.getGlobals().selectedConfig = "Release";
+    project.getGlobals().browser.cameraX = 8.f;
+    project.getGlobals().browser.selectedTargetName = "";
+    project.getTargets()[0].graphical = {1.f, 2.f, false};
+
+    for (CmagProjectFormat format : {CmagProjectFormat::Json, CmagProjectFormat::Binary}) {
+        std::ostringstream stream;
+        CmagProjectFile::writeProject(project, snapshot, stream, format);
+
+        CmagProject derivedProject{};
+        const auto parseResult = CmagProjectFile::parseProject(stream.str(), derivedProject);
+        if (parseResult.status != ParseResultStatus::Success && parseResult.status != ParseResultStatus::DataDerivationFailed) {
+            ASSERT_EQ(ParseResultStatus::Success, parseResult.status);
+        }
+
+        const CmagGlobals &globals = derivedProject.getGlobals();
+        EXPECT_FALSE(globals.darkMode);
+        EXPECT_EQ("Debug", globals.selectedConfig);
+        EXPECT_EQ(4.f, globals.browser.cameraX);
+        EXPECT_EQ("myTarget", globals.browser.selectedTargetName);
+        ASSERT_EQ(1u, derivedProject.getTargets().size());
+        EXPECT_EQ(12.f, derivedProject.getTargets()[0].graphical.x);
+        EXPECT_EQ(25.f, derivedProject.getTargets()[0].graphical.y);
+        EXPECT_TRUE(derivedProject.getTargets()[0].graphical.hideConnections);
+    }
+}
@@ -265,6 +265,44 @@ TEST(CmagProjectTest, givenAliasesWhenAddingTargetAliasesThenFillAliasesVectorCo
     }
 }
 
+TEST(CmagProjectTest, givenTargetsAndAliasesWhenFindingTargetByNameThenReturnCorrectTarget) {
+    CmagProject project = {};
+
+    CmagTarget target1 = {
+        "target1",
+        CmagTargetType::Executable,
+        {
+            {"Debug", {}},
+        },
+        {},
+    };
+    target1.aliases = {"A"};
+
+    CmagTarget target2 = {
+        "target2",
+        CmagTargetType::Executable,
+        {
+            {"Debug", {}},
+        },
+        {},
+    };
+
+    EXPECT_TRUE(project.addTarget(CmagTarget{target1}));
+    EXPECT_TRUE(project.addTarget(CmagTarget{target2}));
+    EXPECT_TRUE(project.addTargetAlias("B", "target2"));
+    EXPECT_FALSE(project.addTargetAlias("C", "A"));
+
+    const std::vector<CmagTarget> &targets = project.getTargets();
+    ASSERT_EQ(2u, targets.size());
+    EXPECT_EQ(&targets[0], project.findTargetByName("target1"));
+    EXPECT_EQ(&targets[0], project.findTargetByName("A"));
+    EXPECT_EQ(&targets[1], project.findTargetByName("target2"));
+    EXPECT_EQ(&targets[1], project.findTargetByName("B"));
+    EXPECT_EQ(nullptr, project.findTargetByName("C"));
+    EXPECT_EQ(nullptr, project.findTargetByName("target3"));
+    EXPECT_EQ(nullptr, project.findTargetByName(""));
+}
+
 struct CmagProjectDeriveTest : ::testing::Test {
     struct CmagProjectWhitebox : CmagProject {
         using CmagProject::CmagProject;
@@ -490,6 +528,69 @@ TEST_F(CmagProjectDeriveTest, givenTargetWithMultipleConfigsWhenDerivingDataThen
     EXPECT_FALSE(propertiesRelWithDeb[4].isConsistent);
 }
 
+TEST_F(CmagProjectDeriveTest, givenTargetsWithEqualPropertyValuesWhenDerivingDataThenValuesShareIds) {
+    project.getGlobals().listDirs = {CmagListDir{"a", {}}};
+    auto createTarget = [](const char *name, const char *releaseValue) {
+        CmagTarget target = {};
+        target.name = name;
+        target.type = CmagTargetType::Executable;
+        target.configs = {
+            {"Debug", {{"A", "a"}, {"B", ""}}},
+            {"Release", {{"A", releaseValue}, {"B", ""}}},
+        };
+        target.listDirName = "a";
+        return target;
+    };
+    EXPECT_TRUE(project.addTarget(createTarget("target1", "a")));
+    EXPECT_TRUE(project.addTarget(createTarget("target2", "aa")));
+    ASSERT_TRUE(project.deriveData());
+
+    const CmagPropertyValueTable &values = project.getPropertyValues();
+    EXPECT_EQ(3u, values.size());
+    const CmagPropertyValueId idA = values.find("a");
+    ASSERT_NE(CmagPropertyValueId::Invalid, idA);
+
+    const CmagTarget &target1 = project.getTargets()[0];
+    const CmagTarget &target2 = project.getTargets()[1];
+    EXPECT_EQ(idA, target1.configs[0].properties[0].valueId);
+    EXPECT_EQ(idA, target1.configs[1].properties[0].valueId);
+    EXPECT_EQ(idA, target2.configs[0].properties[0].valueId);
+    EXPECT_EQ(values.find("aa"), target2.configs[1].properties[0].valueId);
+    EXPECT_EQ(CmagPropertyValueId::Empty, target2.configs[1].properties[1].valueId);
+    EXPECT_EQ(target1.configs[0].properties[0].value.data(), values.getValue(idA).data());
+    EXPECT_TRUE(target1.configs[0].properties[0].isConsistent);
+    EXPECT_FALSE(target2.configs[0].properties[0].isConsistent);
+    EXPECT_TRUE(target2.configs[0].properties[1].isConsistent);
+
+    EXPECT_TRUE(project.replaceTargetConfigs("target2", {{"Debug", {{"A", "b"}, {"B", ""}}}, {"Release", {{"A", "b"}, {"B", ""}}}}));
+    ASSERT_TRUE(project.deriveDirtyData());
+    EXPECT_EQ(values.find("b"), project.getTargets()[1].configs[1].properties[0].valueId);
+    EXPECT_TRUE(project.getTargets()[1].configs[0].properties[0].isConsistent);
+    EXPECT_NE(CmagPropertyValueId::Invalid, values.find("aa")); // stale values are not removed from the table
+    EXPECT_EQ(4u, values.size());
+    EXPECT_EQ(idA, project.getTargets()[0].configs[1].properties[0].valueId);
+}
+
+TEST_F(CmagProjectDeriveTest, givenPropertyMissingInSomeConfigsWhenDerivingDataThenItIsNotConsistent) {
+    project.getGlobals().listDirs = {CmagListDir{"a", {}}};
+    CmagTarget target = {};
+    target.name = "target";
+    target.type = CmagTargetType::Executable;
+    target.configs = {
+        {"Debug", {{"A", "a"}, {"B", "b"}}},
+        {"Release", {{"A", "a"}, {"C", "c"}}},
+    };
+    target.listDirName = "a";
+    EXPECT_TRUE(project.addTarget(std::move(target)));
+    ASSERT_TRUE(project.deriveData());
+
+    const CmagTarget &derivedTarget = project.getTargets()[0];
+    EXPECT_TRUE(derivedTarget.configs[0].properties[0].isConsistent);
+    EXPECT_FALSE(derivedTarget.configs[0].properties[1].isConsistent);
+    EXPECT_TRUE(derivedTarget.configs[1].properties[0].isConsistent);
+    EXPECT_FALSE(derivedTarget.configs[1].properties[1].isConsistent);
+}
+
 TEST_F(CmagProjectDeriveTest, givenTargetsWithListDirsWhenDerivingDataThenListDirIndicesAreCorrectlyDerived) {
     project.getGlobals().listDirs = {
         CmagListDir{
@@ -688,6 +789,40 @@ TEST_F(CmagProjectDeriveTest, givenTargetsWithFoldersWhenDerivingDataThenAssignT
     }
 }
 
+TEST_F(CmagProjectDeriveTest, givenTargetsWithFoldersContainingEmptyNamesWhenDerivingDataThenTreatThemAsSeparateFolders) {
+    project.getGlobals().listDirs = {CmagListDir{"a", {}}};
+
+    auto createTarget = [](const char *name, const char *folder) {
+        CmagTarget target = {};
+        target.name = name;
+        target.type = CmagTargetType::Executable;
+        target.configs = {{
+            "Debug",
+            {
+                {"FOLDER", folder},
+            },
+        }};
+        target.listDirName = "a";
+        return target;
+    };
+
+    EXPECT_TRUE(project.addTarget(createTarget("C", "c")));
+    EXPECT_TRUE(project.addTarget(createTarget("EmptyC", "/c")));
+    EXPECT_TRUE(project.addTarget(createTarget("Empty", "/")));
+    ASSERT_TRUE(project.deriveData());
+
+    const std::vector<CmagFolder> &folders = project.getGlobals().derived.folders;
+    ASSERT_EQ(5u, folders.size());
+    EXPECT_EQ((std::vector<size_t>{1, 2}), folders[0].childIndices); // { c, <empty> }
+    EXPECT_EQ((std::vector<size_t>{0}), folders[1].targetIndices);   // { C }
+    EXPECT_STREQ("", folders[2].relativeName.c_str());
+    EXPECT_EQ((std::vector<size_t>{3, 4}), folders[2].childIndices); // { /c, / }
+    EXPECT_STREQ("c", folders[3].relativeName.c_str());
+    EXPECT_EQ((std::vector<size_t>{1}), folders[3].targetIndices); // { EmptyC }
+    EXPECT_STREQ("", folders[4].relativeName.c_str());
+    EXPECT_EQ((std::vector<size_t>{2}), folders[4].targetIndices); // { Empty }
+}
+
 TEST_F(CmagProjectDeriveTest, givenTargetsWithDependenciesWhenDerivingDataThenCorrectlyDeriveIsReferencedField) {
     project.getGlobals().listDirs = {CmagListDir{"a", {}}};
 
@@ -743,6 +878,67 @@ TEST_F(CmagProjectDeriveTest, givenTargetsWithDependenciesWhenDerivingDataThenCo
     ASSERT_FALSE(targets[11].derived.isReferenced);
 }
 
+TEST_F(CmagProjectDeriveTest, givenTargetsWithDependenciesWhenDerivingDataThenCreateDependencyGraphForEachConfig) {
+    project.getGlobals().listDirs = {CmagListDir{"a", {}}};
+
+    auto createConfig = [](const char *configName, const char *linkLibs, const char *interfaceLinkLibs, const char *deps) {
+        return CmagTargetConfig{
+            configName,
+            {
+                {"LINK_LIBRARIES", linkLibs},
+                {"INTERFACE_LINK_LIBRARIES", interfaceLinkLibs},
+                {"MANUALLY_ADDED_DEPENDENCIES", deps},
+            },
+        };
+    };
+    auto createTarget = [](const char *name, std::vector<CmagTargetConfig> &&configs) {
+        CmagTarget target = {};
+        target.name = name;
+        target.type = CmagTargetType::Executable;
+        target.configs = std::move(configs);
+        target.listDirName = "a";
+        return target;
+    };
+
+    EXPECT_TRUE(project.addTarget(createTarget("A", {createConfig("Debug", "C;B;Ext1", "B", "C"), createConfig("Release", "B", "", "")})));
+    EXPECT_TRUE(project.addTarget(createTarget("B", {createConfig("Debug", "A;C", "", ""), createConfig("Release", "", "", "")})));
+    EXPECT_TRUE(project.addTarget(createTarget("C", {createConfig("Debug", "", "", "")})));
+    ASSERT_TRUE(project.deriveData());
+
+    using EdgeList = std::vector<std::pair<uint32_t, CmagDependencyType>>;
+    auto toList = [](const CmagDependencyGraph::EdgeRange &edges) {
+        EdgeList result = {};
+        for (const CmagDependencyGraph::Edge &edge : edges) {
+            result.emplace_back(edge.targetIndex, edge.types);
+        }
+        return result;
+    };
+    constexpr CmagDependencyType build = CmagDependencyType::Build;
+    constexpr CmagDependencyType interface = CmagDependencyType::Interface;
+    constexpr CmagDependencyType additional = CmagDependencyType::Additional;
+
+    const CmagDependencyGraph *debugGraph = project.findDependencyGraph("Debug");
+    ASSERT_NE(nullptr, debugGraph);
+    ASSERT_EQ(3u, debugGraph->getTargetsCount());
+    EXPECT_EQ(4u, debugGraph->getEdgesCount());
+    EXPECT_EQ((EdgeList{{1, build | interface}, {2, build | additional}}), toList(debugGraph->getDependencies(0)));
+    EXPECT_EQ((EdgeList{{0, build}, {2, build}}), toList(debugGraph->getDependencies(1)));
+    EXPECT_EQ((EdgeList{}), toList(debugGraph->getDependencies(2)));
+    EXPECT_EQ((EdgeList{{1, build}}), toList(debugGraph->getDependents(0)));
+    EXPECT_EQ((EdgeList{{0, build | interface}}), toList(debugGraph->getDependents(1)));
+    EXPECT_EQ((EdgeList{{0, build | additional}, {1, build}}), toList(debugGraph->getDependents(2)));
+
+    const CmagDependencyGraph *releaseGraph = project.findDependencyGraph("Release");
+    ASSERT_NE(nullptr, releaseGraph);
+    ASSERT_EQ(3u, releaseGraph->getTargetsCount());
+    EXPECT_EQ(1u, releaseGraph->getEdgesCount());
+    EXPECT_EQ((EdgeList{{1, build}}), toList(releaseGraph->getDependencies(0)));
+    EXPECT_EQ((EdgeList{{0, build}}), toList(releaseGraph->getDependents(1)));
+    EXPECT_TRUE(releaseGraph->getDependencies(2).empty());
+
+    EXPECT_EQ(nullptr, project.findDependencyGraph("RelWithDebInfo"));
+}
+
 TEST_F(CmagProjectDeriveTest, givenTargetsWithDependenciesWhenDerivingDataThenCorrectlyDeriveUnmatchedDependenciesField) {
     project.getGlobals().listDirs = {CmagListDir{"a", {}}};
 
@@ -775,6 +971,485 @@ TEST_F(CmagProjectDeriveTest, givenTargetsWithDependenciesWhenDerivingDataThenCo
     EXPECT_EQ((std::vector<std::string>{"Ext4", "Ext1", "Ext3", "Ext2"}), targets[2].configs[0].derived.unmatchedDependencies);
 
     EXPECT_EQ((std::vector<std::string>{"Ext1", "Ext2", "Ext3", "Ext4"}), project.getUnmatchedDependencies());
+    EXPECT_EQ((std::vector<size_t>{0, 1, 2}), *project.findUnmatchedDependencyTargetIndices("Ext1"));
+    EXPECT_EQ((std::vector<size_t>{0, 2}), *project.findUnmatchedDependencyTargetIndices("Ext2"));
+    EXPECT_EQ((std::vector<size_t>{0, 2}), *project.findUnmatchedDependencyTargetIndices("Ext3"));
+    EXPECT_EQ((std::vector<size_t>{0, 1, 2}), *project.findUnmatchedDependencyTargetIndices("Ext4"));
+    EXPECT_EQ(nullptr, project.findUnmatchedDependencyTargetIndices("A"));
+    EXPECT_EQ(nullptr, project.findUnmatchedDependencyTargetIndices("Ext5"));
+}
+
+TEST_F(CmagProjectDeriveTest, givenDependenciesReferencedByAliasesWhenDerivingDataThenResolveThem) {
+    project.getGlobals().listDirs = {CmagListDir{"a", {}}};
+
+    auto createTarget = [](const char *name, const char *linkLibs) {
+        CmagTarget target = {};
+        target.name = name;
+        target.type = CmagTargetType::Executable;
+        target.configs = {{
+            "Debug",
+            {
+                {"LINK_LIBRARIES", linkLibs},
+            },
+        }};
+        target.listDirName = "a";
+        return target;
+    };
+
+    EXPECT_TRUE(project.addTarget(createTarget("A", "ns::B;C;ns::A;ns::D")));
+    EXPECT_TRUE(project.addTarget(createTarget("B", "")));
+    EXPECT_TRUE(project.addTarget(createTarget("C", "")));
+    EXPECT_TRUE(project.addTargetAlias("ns::A", "A"));
+    EXPECT_TRUE(project.addTargetAlias("ns::B", "B"));
+
+    ASSERT_TRUE(project.deriveData());
+
+    const std::vector<CmagTarget> &targets = project.getTargets();
+    ASSERT_EQ(3u, targets.size());
+    const CmagTargetConfig &config = targets[0].configs[0];
+    EXPECT_EQ((std::vector<const CmagTarget *>{&targets[1], &targets[2]}), config.derived.buildDependencies);
+    EXPECT_EQ((std::vector<std::string>{"ns::D"}), config.derived.unmatchedDependencies);
+    EXPECT_FALSE(targets[0].derived.isReferenced);
+    EXPECT_TRUE(targets[1].derived.isReferenced);
+    EXPECT_TRUE(targets[2].derived.isReferenced);
+}
+
+TEST_F(CmagProjectDeriveTest, givenTargetsWithPropertiesWhenDerivingDataThenPropertiesCanBeFoundById) {
+    project.getGlobals().listDirs = {CmagListDir{"a", {}}};
+
+    EXPECT_TRUE(project.addTarget(CmagTarget{
+        "target",
+        CmagTargetType::Executable,
+        {
+            {
+                "Debug",
+                {
+                    {"A", "a"},
+                    {"LINK_LIBRARIES", "lib"},
+                    {"A", "duplicate"},
+                },
+            },
+            {
+                "Release",
+                {
+                    {"B", "b"},
+                },
+            },
+        },
+        CmagTargetGraphicalData{},
+        nullptr,
+        "a",
+    }));
+    ASSERT_TRUE(project.deriveData());
+
+    const CmagPropertyNameTable &propertyNames = project.getPropertyNames();
+    const CmagPropertyId idA = propertyNames.find("A");
+    const CmagPropertyId idB = propertyNames.find("B");
+    ASSERT_NE(CmagPropertyId::Invalid, idA);
+    ASSERT_NE(CmagPropertyId::Invalid, idB);
+    EXPECT_EQ(CmagPropertyId::Invalid, propertyNames.find("C"));
+    EXPECT_EQ(CmagPropertyId::LinkLibraries, propertyNames.find("LINK_LIBRARIES"));
+    EXPECT_EQ(CmagPropertyId::Folder, propertyNames.find("FOLDER"));
+
+    const CmagTargetConfig &debugConfig = project.getTargets()[0].configs[0];
+    ASSERT_NE(nullptr, debugConfig.findProperty(idA));
+    EXPECT_EQ("a", debugConfig.findProperty(idA)->value);
+    EXPECT_EQ(debugConfig.findProperty("A"), debugConfig.findProperty(idA));
+    EXPECT_EQ("lib", debugConfig.findProperty(CmagPropertyId::LinkLibraries)->value);
+    EXPECT_EQ(nullptr, debugConfig.findProperty(idB));
+    EXPECT_EQ(nullptr, debugConfig.findProperty(CmagPropertyId::Folder));
+    EXPECT_EQ(nullptr, debugConfig.findProperty(CmagPropertyId::Invalid));
+
+    const CmagTargetConfig &releaseConfig = project.getTargets()[0].configs[1];
+    ASSERT_NE(nullptr, releaseConfig.findProperty(idB));
+    EXPECT_EQ("b", releaseConfig.findProperty(idB)->value);
+    EXPECT_EQ(nullptr, releaseConfig.findProperty(idA));
+}
+
+static void expectSameDerivedData(const CmagProject &projectA, const CmagProject &projectB) {
+    auto toIndices = [](const CmagProject &project, const std::vector<const CmagTarget *> &dependencies) {
+        std::vector<size_t> result = {};
+        for (const CmagTarget *dependency : dependencies) {
+            result.push_back(static_cast<size_t>(dependency - project.getTargets().data()));
+        }
+        return result;
+    };
+
+    EXPECT_EQ(projectA.getUnmatchedDependencies(), projectB.getUnmatchedDependencies());
+    for (const std::string &dependency : projectA.getUnmatchedDependencies()) {
+        const std::vector<size_t> *targetIndicesA = projectA.findUnmatchedDependencyTargetIndices(dependency);
+        const std::vector<size_t> *targetIndicesB = projectB.findUnmatchedDependencyTargetIndices(dependency);
+        ASSERT_NE(nullptr, targetIndicesA);
+        ASSERT_NE(nullptr, targetIndicesB);
+        EXPECT_EQ(*targetIndicesA, *targetIndicesB) << dependency;
+    }
+
+    auto toPairs = [](const CmagDependencyGraph::EdgeRange &edges) {
+        std::vector<std::pair<uint32_t, CmagDependencyType>> result = {};
+        for (const CmagDependencyGraph::Edge &edge : edges) {
+            result.emplace_back(edge.targetIndex, edge.types);
+        }
+        return result;
+    };
+    ASSERT_EQ(projectA.getConfigs(), projectB.getConfigs());
+    for (const std::string &configName : projectA.getConfigs()) {
+        const CmagDependencyGraph *graphA = projectA.findDependencyGraph(configName);
+        const CmagDependencyGraph *graphB = projectB.findDependencyGraph(configName);
+        ASSERT_NE(nullptr, graphA);
+        ASSERT_NE(nullptr, graphB);
+        ASSERT_EQ(graphA->getTargetsCount(), graphB->getTargetsCount());
+        for (size_t targetIndex = 0; targetIndex < graphA->getTargetsCount(); targetIndex++) {
+            EXPECT_EQ(toPairs(graphA->getDependencies(targetIndex)), toPairs(graphB->getDependencies(targetIndex)));
+            EXPECT_EQ(toPairs(graphA->getDependents(targetIndex)), toPairs(graphB->getDependents(targetIndex)));
+        }
+    }
+
+    const CmagGlobals &globalsA = projectA.getGlobals();
+    const CmagGlobals &globalsB = projectB.getGlobals();
+    ASSERT_EQ(globalsA.derived.folders.size(), globalsB.derived.folders.size());
+    for (size_t folderIndex = 0; folderIndex < globalsA.derived.folders.size(); folderIndex++) {
+        EXPECT_EQ(globalsA.derived.folders[folderIndex].fullName, globalsB.derived.folders[folderIndex].fullName);
+        EXPECT_EQ(globalsA.derived.folders[folderIndex].childIndices, globalsB.derived.folders[folderIndex].childIndices);
+        EXPECT_EQ(globalsA.derived.folders[folderIndex].targetIndices, globalsB.derived.folders[folderIndex].targetIndices);
+    }
+    ASSERT_EQ(globalsA.listDirs.size(), globalsB.listDirs.size());
+    for (size_t listDirIndex = 0; listDirIndex < globalsA.listDirs.size(); listDirIndex++) {
+        EXPECT_EQ(globalsA.listDirs[listDirIndex].derived.targetIndices, globalsB.listDirs[listDirIndex].derived.targetIndices);
+    }
+
+    ASSERT_EQ(projectA.getTargets().size(), projectB.getTargets().size());
+    for (size_t targetIndex = 0; targetIndex < projectA.getTargets().size(); targetIndex++) {
+        const CmagTarget &targetA = projectA.getTargets()[targetIndex];
+        const CmagTarget &targetB = projectB.getTargets()[targetIndex];
+        EXPECT_EQ(targetA.derived.isReferenced, targetB.derived.isReferenced);
+        EXPECT_EQ(targetA.derived.referencesCount, targetB.derived.referencesCount);
+
+        ASSERT_EQ(targetA.configs.size(), targetB.configs.size());
+        for (size_t configIndex = 0; configIndex < targetA.configs.size(); configIndex++) {
+            const CmagTargetConfig &configA = targetA.configs[configIndex];
+            const CmagTargetConfig &configB = targetB.configs[configIndex];
+            EXPECT_EQ(toIndices(projectA, configA.derived.buildDependencies), toIndices(projectB, configB.derived.buildDependencies));
+            EXPECT_EQ(toIndices(projectA, configA.derived.interfaceDependencies), toIndices(projectB, configB.derived.interfaceDependencies));
+            EXPECT_EQ(toIndices(projectA, configA.derived.manualDependencies), toIndices(projectB, configB.derived.manualDependencies));
+            EXPECT_EQ(toIndices(projectA, configA.derived.allDependencies), toIndices(projectB, configB.derived.allDependencies));
+            EXPECT_EQ(configA.derived.unmatchedDependencies, configB.derived.unmatchedDependencies);
+            ASSERT_EQ(configA.properties.size(), configB.properties.size());
+            for (size_t propertyIndex = 0; propertyIndex < configA.properties.size(); propertyIndex++) {
+                EXPECT_EQ(configA.properties[propertyIndex].isConsistent, configB.properties[propertyIndex].isConsistent);
+            }
+        }
+    }
+}
+
+TEST(CmagProjectMultithreadedDeriveTest, givenBigProjectWhenDerivingDataWithMultipleThreadsThenResultsAreTheSameAsWithOneThread) {
+    auto createProject = []() {
+        CmagProject project = {};
+        project.getGlobals().listDirs = {CmagListDir{"a", {}}};
+
+        const size_t targetsCount = 500;
+        for (size_t targetIndex = 0; targetIndex < targetsCount; targetIndex++) {
+            std::string linkLibraries = {};
+            std::string interfaceLinkLibraries = {};
+            for (size_t dependencyIndex = 1; dependencyIndex <= 3; dependencyIndex++) {
+                linkLibraries += "T" + std::to_string((targetIndex * 7 + dependencyIndex * 13) % targetsCount) + ";";
+                interfaceLinkLibraries += "T" + std::to_string((targetIndex * 11 + dependencyIndex) % (targetsCount * 2)) + ";";
+            }
+            linkLibraries += "external" + std::to_string(targetIndex % 17);
+            const std::string folder = "folder" + std::to_string(targetIndex % 5);
+
+            CmagTarget target = {};
+            target.name = "T" + std::to_string(targetIndex);
+            target.type = CmagTargetType::StaticLibrary;
+            target.listDirName = "a";
+            for (const char *configName : {"Debug", "Release"}) {
+                target.configs.push_back(CmagTargetConfig{
+                    configName,
+                    {
+                        {"LINK_LIBRARIES", linkLibraries},
+                        {"INTERFACE_LINK_LIBRARIES", interfaceLinkLibraries},
+                        {"FOLDER", folder},
+                        {"OPTIONS", targetIndex % 3 == 0 ? configName : "same"},
+                    },
+                });
+            }
+            EXPECT_TRUE(project.addTarget(std::move(target)));
+        }
+        return project;
+    };
+
+    CmagProject serialProject = createProject();
+    CmagProject parallelProject = createProject();
+    ASSERT_TRUE(serialProject.deriveData(false));
+    ASSERT_TRUE(parallelProject.deriveData(true));
+
+    expectSameDerivedData(serialProject, parallelProject);
+    EXPECT_FALSE(serialProject.getUnmatchedDependencies().empty());
+}
+
+struct CmagProjectIncrementalDeriveTest : ::testing::Test {
+    static CmagTarget createTarget(const char *name, const char *listDir, const char *folder, const char *linkLibs) {
+        CmagTarget target = {};
+        target.name = name;
+        target.type = CmagTargetType::StaticLibrary;
+        target.listDirName = listDir;
+        for (const char *configName : {"Debug", "Release"}) {
+            target.configs.push_back(createConfig(configName, folder, linkLibs));
+        }
+        return target;
+    }
+
+    static CmagTargetConfig createConfig(const char *configName, const char *folder, const char *linkLibs) {
+        return CmagTargetConfig{
+            configName,
+            {
+                {"FOLDER", folder},
+                {"LINK_LIBRARIES", linkLibs},
+            },
+        };
+    }
+
+    static void addTargets(CmagProject &project, const std::vector<CmagTarget> &targets) {
+        project.getGlobals().listDirs = {CmagListDir{"a", {1}}, CmagListDir{"b", {}}};
+        for (const CmagTarget &target : targets) {
+            EXPECT_TRUE(project.addTarget(CmagTarget{target}));
+        }
+    }
+
+    std::vector<CmagTarget> targets = {
+        createTarget("A", "a", "", "B;C;external1"),
+        createTarget("B", "a", "f1", "C;external2"),
+        createTarget("C", "b", "f1/f2", ""),
+        createTarget("D", "b", "f3", "external1;C"),
+    };
+};
+
+TEST_F(CmagProjectIncrementalDeriveTest, givenNoFullDerivationWhenDerivingDirtyDataThenPerformFullDerivation) {
+    CmagProject project = {};
+    addTargets(project, targets);
+    EXPECT_TRUE(project.markTargetDirty("A"));
+    EXPECT_FALSE(project.markTargetDirty("X"));
+    ASSERT_TRUE(project.deriveDirtyData());
+
+    CmagProject expectedProject = {};
+    addTargets(expectedProject, targets);
+    ASSERT_TRUE(expectedProject.deriveData());
+    expectSameDerivedData(expectedProject, project);
+}
+
+TEST_F(CmagProjectIncrementalDeriveTest, givenDependenciesChangedWhenDerivingDirtyDataThenResultIsTheSameAsAfterFullDerivation) {
+    CmagProject project = {};
+    addTargets(project, targets);
+    ASSERT_TRUE(project.deriveData());
+    EXPECT_EQ((std::vector<std::string>{"external1", "external2"}), project.getUnmatchedDependencies());
+
+    // Replace the configs, so B no longer depends on C and external2 is no longer referenced.
+    targets[1].configs = {createConfig("Debug", "f1", "A;external3"), createConfig("Release", "f1", "A;external3")};
+    EXPECT_TRUE(project.replaceTargetConfigs("B", std::vector<CmagTargetConfig>{targets[1].configs}));
+    EXPECT_FALSE(project.replaceTargetConfigs("X", {}));
+
+    // Modify properties in place.
+    for (CmagTargetConfig *config : {&targets[3].configs[0], &project.getTargets()[3].configs[0]}) {
+        config->findProperty("LINK_LIBRARIES")->value = "";
+    }
+    EXPECT_TRUE(project.markTargetDirty("D"));
+    EXPECT_TRUE(project.markTargetDirty("D"));
+    ASSERT_TRUE(project.deriveDirtyData());
+
+    CmagProject expectedProject = {};
+    addTargets(expectedProject, targets);
+    ASSERT_TRUE(expectedProject.deriveData());
+    expectSameDerivedData(expectedProject, project);
+    EXPECT_EQ((std::vector<std::string>{"external1", "external3"}), project.getUnmatchedDependencies());
+    EXPECT_EQ((std::vector<size_t>{0, 3}), *project.findUnmatchedDependencyTargetIndices("external1"));
+    EXPECT_EQ((std::vector<size_t>{1}), *project.findUnmatchedDependencyTargetIndices("external3"));
+    EXPECT_EQ(nullptr, project.findUnmatchedDependencyTargetIndices("external2"));
+    EXPECT_TRUE(project.getTargets()[0].derived.isReferenced);
+    EXPECT_FALSE(project.getTargets()[3].derived.isReferenced);
+}
+
+TEST_F(CmagProjectIncrementalDeriveTest, givenEqualValuesWhenAddingTargetsThenTheyShareStorageAndDirtyDerivationDoesNotReinternThem) {
+    CmagProject project = {};
+    addTargets(project, targets);
+    ASSERT_TRUE(project.deriveData());
+
+    // "B;C;external1" is used by both configs of A, "f1" by both configs of B.
+    const CmagTargetProperty &debugLinkLibraries = *project.getTargets()[0].configs[0].findProperty(CmagPropertyId::LinkLibraries);
+    const CmagTargetProperty &releaseLinkLibraries = *project.getTargets()[0].configs[1].findProperty(CmagPropertyId::LinkLibraries);
+    EXPECT_EQ(debugLinkLibraries.valueId, releaseLinkLibraries.valueId);
+    EXPECT_EQ(debugLinkLibraries.getValue().data(), releaseLinkLibraries.getValue().data());
+    EXPECT_EQ(project.getPropertyValues().getValue(debugLinkLibraries.valueId).data(), debugLinkLibraries.getValue().data());
+    EXPECT_EQ(project.getTargets()[1].configs[0].findProperty(CmagPropertyId::Folder)->getValue().data(),
+              project.getTargets()[1].configs[1].findProperty(CmagPropertyId::Folder)->getValue().data());
+
+    const size_t valuesCount = project.getPropertyValues().size();
+    const char *storedValue = debugLinkLibraries.getValue().data();
+    EXPECT_TRUE(project.markTargetDirty("A"));
+    EXPECT_TRUE(project.markTargetDirty("C"));
+    ASSERT_TRUE(project.deriveDirtyData());
+    EXPECT_EQ(valuesCount, project.getPropertyValues().size());
+    EXPECT_EQ(storedValue, project.getTargets()[0].configs[0].findProperty(CmagPropertyId::LinkLibraries)->getValue().data());
+
+    EXPECT_TRUE(project.replaceTargetConfigs("C", {createConfig("Debug", "f1", "B;C;external1"), createConfig("Release", "f1", "new")}));
+    ASSERT_TRUE(project.deriveDirtyData());
+    EXPECT_EQ(valuesCount + 1, project.getPropertyValues().size());
+    EXPECT_EQ(storedValue, project.getTargets()[2].configs[0].findProperty(CmagPropertyId::LinkLibraries)->getValue().data());
+}
+
+TEST_F(CmagProjectIncrementalDeriveTest, givenDirtyTargetsWhenDerivingDirtyDataThenOnlyAnalysesOfChangedEdgesAreRecalculated) {
+    CmagProject project = {};
+    addTargets(project, targets);
+    ASSERT_TRUE(project.deriveData());
+
+    // Analyses are queried in the order of their cache slots, so recalculated ones wouldn't get the same addresses.
+    const CmagDependencyReachability *debugBuild = project.getDependencyReachability("Debug", CmagDependencyType::Build);
+    const CmagDependencyReachability *debugInterface = project.getDependencyReachability("Debug", CmagDependencyType::Interface);
+    const CmagDependencyReachability *releaseBuild = project.getDependencyReachability("Release", CmagDependencyType::Build);
+    const CmagDependencyReachability *releaseDefault = project.getDependencyReachability("Release", CmagDependencyType::DEFAULT);
+    EXPECT_TRUE(debugBuild->dependsOn(1, 2));
+
+    // Dependencies of A don't change, so nothing has to be recalculated.
+    EXPECT_TRUE(project.markTargetDirty("A"));
+    ASSERT_TRUE(project.deriveDirtyData());
+    EXPECT_EQ(debugBuild, project.getDependencyReachability("Debug", CmagDependencyType::Build));
+    EXPECT_EQ(debugInterface, project.getDependencyReachability("Debug", CmagDependencyType::Interface));
+    EXPECT_EQ(releaseBuild, project.getDependencyReachability("Release", CmagDependencyType::Build));
+    EXPECT_EQ(releaseDefault, project.getDependencyReachability("Release", CmagDependencyType::DEFAULT));
+
+    // B no longer depends on C in Debug. Only build dependencies of the Debug graph change.
+    const CmagTarget *const *untouchedDependencies = project.getTargets()[0].configs[0].derived.buildDependencies.data();
+    targets[1].configs = {createConfig("Debug", "f1", "external2"), createConfig("Release", "f1", "C;external2")};
+    EXPECT_TRUE(project.replaceTargetConfigs("B", std::vector<CmagTargetConfig>{targets[1].configs}));
+    ASSERT_TRUE(project.deriveDirtyData());
+    EXPECT_FALSE(project.getDependencyReachability("Debug", CmagDependencyType::Build)->dependsOn(1, 2));
+    EXPECT_EQ(debugInterface, project.getDependencyReachability("Debug", CmagDependencyType::Interface));
+    EXPECT_EQ(releaseBuild, project.getDependencyReachability("Release", CmagDependencyType::Build));
+    EXPECT_EQ(releaseDefault, project.getDependencyReachability("Release", CmagDependencyType::DEFAULT));
+    EXPECT_TRUE(releaseBuild->dependsOn(1, 2));
+    EXPECT_EQ(untouchedDependencies, project.getTargets()[0].configs[0].derived.buildDependencies.data());
+
+    CmagProject expectedProject = {};
+    addTargets(expectedProject, targets);
+    ASSERT_TRUE(expectedProject.deriveData());
+    expectSameDerivedData(expectedProject, project);
+    const CmagDependencyGraph &expectedGraph = *expectedProject.findDependencyGraph("Debug");
+    const CmagDependencyGraph &graph = *project.findDependencyGraph("Debug");
+    ASSERT_EQ(expectedGraph.getEdgesCount(), graph.getEdgesCount());
+    for (size_t targetIndex = 0; targetIndex < targets.size(); targetIndex++) {
+        EXPECT_EQ(expectedGraph.getDependencies(targetIndex).size(), graph.getDependencies(targetIndex).size());
+        EXPECT_EQ(expectedGraph.getDependents(targetIndex).size(), graph.getDependents(targetIndex).size());
+    }
+}
+
+TEST_F(CmagProjectIncrementalDeriveTest, givenAllReferencingTargetsDirtyWhenDerivingDirtyDataThenUnmatchedDependenciesKeepTheirOrder) {
+    CmagProject project = {};
+    addTargets(project, targets);
+    ASSERT_TRUE(project.deriveData());
+
+    // Both targets referencing external1 are dirty, so it temporarily loses all its references.
+    EXPECT_TRUE(project.markTargetDirty("D"));
+    EXPECT_TRUE(project.markTargetDirty("A"));
+    ASSERT_TRUE(project.deriveDirtyData());
+
+    CmagProject expectedProject = {};
+    addTargets(expectedProject, targets);
+    ASSERT_TRUE(expectedProject.deriveData());
+    expectSameDerivedData(expectedProject, project);
+    EXPECT_EQ((std::vector<std::string>{"external1", "external2"}), project.getUnmatchedDependencies());
+    EXPECT_EQ((std::vector<size_t>{0, 3}), *project.findUnmatchedDependencyTargetIndices("external1"));
+}
+
+TEST_F(CmagProjectIncrementalDeriveTest, givenFoldersAndListDirsChangedWhenDerivingDirtyDataThenResultIsTheSameAsAfterFullDerivation) {
+    CmagProject project = {};
+    addTargets(project, targets);
+    ASSERT_TRUE(project.deriveData());
+
+    // Move C to a new folder, so f1/f2 becomes empty and has to disappear. Move D to a different list dir.
+    targets[2].configs = {createConfig("Debug", "f4", ""), createConfig("Release", "f4", "")};
+    EXPECT_TRUE(project.replaceTargetConfigs("C", std::vector<CmagTargetConfig>{targets[2].configs}));
+    targets[3].listDirName = "a";
+    project.getTargets()[3].listDirName = "a";
+    EXPECT_TRUE(project.markTargetDirty("D"));
+    ASSERT_TRUE(project.deriveDirtyData());
+
+    CmagProject expectedProject = {};
+    addTargets(expectedProject, targets);
+    ASSERT_TRUE(expectedProject.deriveData());
+    expectSameDerivedData(expectedProject, project);
+    EXPECT_EQ((std::vector<size_t>{0, 1, 3}), project.getGlobals().listDirs[0].derived.targetIndices);
+    EXPECT_EQ((std::vector<size_t>{2}), project.getGlobals().listDirs[1].derived.targetIndices);
+}
+
+TEST_F(CmagProjectIncrementalDeriveTest, givenInconsistentFolderWhenDerivingDirtyDataThenReturnError) {
+    CmagProject project = {};
+    addTargets(project, targets);
+    ASSERT_TRUE(project.deriveData());
+
+    EXPECT_TRUE(project.replaceTargetConfigs("C", {createConfig("Debug", "f4", ""), createConfig("Release", "f5", "")}));
+    EXPECT_FALSE(project.deriveDirtyData());
+}
+
+TEST_F(CmagProjectIncrementalDeriveTest, givenNewTargetAddedWhenDerivingDirtyDataThenPerformFullDerivation) {
+    CmagProject project = {};
+    addTargets(project, targets);
+    ASSERT_TRUE(project.deriveData());
+
+    targets.push_back(createTarget("external1", "b", "", ""));
+    EXPECT_TRUE(project.addTarget(CmagTarget{targets.back()}));
+    ASSERT_TRUE(project.deriveDirtyData());
+
+    CmagProject expectedProject = {};
+    addTargets(expectedProject, targets);
+    ASSERT_TRUE(expectedProject.deriveData());
+    expectSameDerivedData(expectedProject, project);
+    EXPECT_EQ((std::vector<std::string>{"external2"}), project.getUnmatchedDependencies());
+}
+
+TEST(CmagPropertyNameTableTest, givenNamesWhenInterningThenReturnStableIds) {
+    CmagPropertyNameTable table = {};
+    EXPECT_EQ(static_cast<size_t>(CmagPropertyId::COUNT_WELL_KNOWN), table.size());
+    EXPECT_EQ(CmagPropertyId::InterfaceLinkLibraries, table.intern("INTERFACE_LINK_LIBRARIES"));
+
+    const CmagPropertyId idA = table.intern("A");
+    const CmagPropertyId idB = table.intern("B");
+    EXPECT_NE(idA, idB);
+    EXPECT_EQ(idA, table.intern("A"));
+    EXPECT_EQ(idB, table.find("B"));
+    EXPECT_EQ("A", table.getName(idA));
+
+    CmagPropertyNameTable copy = table;
+    table = {};
+    EXPECT_EQ(idB, copy.find("B"));
+    EXPECT_EQ("B", copy.getName(idB));
+    EXPECT_EQ(CmagPropertyId::Invalid, table.find("B"));
+}
+
+TEST(CmagPropertyValueTableTest, givenValuesWhenInterningThenEqualValuesShareStorage) {
+    std::pmr::monotonic_buffer_resource memoryResource{};
+    CmagPropertyValueTable table{&memoryResource};
+    EXPECT_EQ(1u, table.size());
+    EXPECT_EQ(CmagPropertyValueId::Empty, table.intern(""));
+
+    std::string valueA = "a;b";
+    const std::string valueB = "b";
+    const std::string valueACopy = valueA;
+    const CmagPropertyValueId idA = table.intern(valueA);
+    const CmagPropertyValueId idB = table.intern(valueB);
+    EXPECT_NE(idA, idB);
+    EXPECT_EQ(idA, table.intern(valueACopy));
+    EXPECT_NE(valueA.data(), table.getValue(idA).data());
+    EXPECT_TRUE(table.isStoredValue(table.getValue(idA), idA));
+    EXPECT_FALSE(table.isStoredValue(valueACopy, idA));
+    EXPECT_EQ(idB, table.find("b"));
+    EXPECT_EQ(3u, table.size());
+
+    valueA = "changed";
+    EXPECT_EQ("a;b", table.getValue(idA));
+
+    const std::string externalValue = "external";
+    const CmagPropertyValueId idExternal = table.internExternal(externalValue);
+    EXPECT_EQ(externalValue.data(), table.getValue(idExternal).data());
+    EXPECT_EQ(idExternal, table.intern("external"));
+    EXPECT_EQ(4u, table.size());
 }
 
 struct CmagTargetConfigTest : ::testing::Test {
@@ -789,8 +1464,9 @@ struct CmagTargetConfigTest : ::testing::Test {
                 {"LINK_LIBRARIES", evaledValue},
             },
         };
-        config.fixupWithNonEvaled("LINK_LIBRARIES", nonEvaledValue);
-        EXPECT_STREQ(expectedValue, config.properties[0].value.c_str());
+        std::pmr::monotonic_buffer_resource memoryResource{};
+        config.fixupWithNonEvaled("LINK_LIBRARIES", nonEvaledValue, &memoryResource);
+        EXPECT_EQ(std::string_view{expectedValue}, config.properties[0].value);
     }
 };
 
@@ -832,3 +1508,22 @@ TEST_F(CmagTargetConfigTest, givenDirectoryIdAndLinkOnlyWhenFixingLinkLibrariesT
     executeTest("::@(000002F0C2555640);Lib1;::@", "::@(000002F0C2555640);$<LINK_ONLY:Lib1>;::@", "");
     executeTest("::@(000002F0C2555640);Lib1;::@;Lib2", "::@(000002F0C2555640);$<LINK_ONLY:Lib1>;::@;Lib2", "Lib2");
 }
+
+TEST_F(CmagTargetConfigTest, givenEscapedCharactersInGenexWhenFixingLinkLibrariesThenStripWholeGenex) {
+    executeTest("Lib1;Lib>2;Lib3", "Lib1;$<LINK_ONLY:Lib$<ANGLE-R>2>;Lib3", "Lib1;Lib3");
+    executeTest("Lib1;Lib2;Lib3", "Lib1;$<LINK_ONLY:Lib2$<SEMICOLON>>;Lib3", "Lib1;Lib3");
+    executeTest("Lib1;Lib2;Lib3", "$<$<BOOL:1>:Lib1>;$<LINK_ONLY:$<IF:$<CONFIG:Debug>,Lib2,Lib2>>;Lib3", "Lib1;Lib3");
+}
+
+TEST_F(CmagTargetConfigTest, givenEmptyListElementsWhenFixingLinkLibrariesThenKeepThem) {
+    executeTest("Lib1;;Lib2;", "Lib1;;$<LINK_ONLY:Lib2>;", "Lib1;;");
+    executeTest(";Lib1;Lib2", ";$<LINK_ONLY:Lib1>;Lib2", ";Lib2");
+    executeTest("Lib1;;Lib2", "$<LINK_ONLY:Lib1>;;Lib2", ";Lib2");
+    executeTest("Lib1;;::@(000002AAB227D1E0);Lib2;::@;", "Lib1;;Lib2;");
+    executeTest(";::@(000002AAB227D1E0);Lib1;::@", ";$<LINK_ONLY:Lib1>", "");
+}
+
+TEST_F(CmagTargetConfigTest, givenEmptyOrUnclosedLinkOnlyWhenFixingLinkLibrariesThenDoNotChangeAnything) {
+    executeTest("Lib1;Lib2", "$<LINK_ONLY:>;Lib2", "Lib1;Lib2");
+    executeTest("Lib1;Lib2", "$<LINK_ONLY:Lib1>;$<LINK_ONLY:Lib2", "Lib1;Lib2");
+}
@@ -0,0 +1,113 @@
+#include "cmag_core/core/cmag_project.h"
+#include "cmag_core/core/dependency_components.h"
+
+#include <gtest/gtest.h>
+
+using Edge = CmagDependencyGraph::Edge;
+
+static CmagDependencyGraph createGraph(std::vector<std::vector<Edge>> edges) {
+    CmagDependencyGraph graph = {};
+    for (std::vector<Edge> &targetEdges : edges) {
+        graph.addTarget(targetEdges);
+    }
+    graph.finalize();
+    return graph;
+}
+
+static std::vector<uint32_t> toVector(const CmagDependencyComponents::IndexRange &range) {
+    return std::vector<uint32_t>{range.begin(), range.end()};
+}
+
+TEST(CmagDependencyComponentsTest, givenDagWhenDerivingComponentsThenEachTargetIsSeparateComponentInReverseTopologicalOrder) {
+    // 0 -> 1 -> 2, 0 -> 2
+    const CmagDependencyGraph graph = createGraph({
+        {{1, CmagDependencyType::Build}, {2, CmagDependencyType::Build}},
+        {{2, CmagDependencyType::Build}},
+        {},
+    });
+
+    CmagDependencyComponents components{graph, CmagDependencyType::Build};
+    ASSERT_EQ(3u, components.getComponentsCount());
+    EXPECT_EQ(3u, components.getTargetsCount());
+    EXPECT_EQ(2u, components.getComponent(0));
+    EXPECT_EQ(1u, components.getComponent(1));
+    EXPECT_EQ(0u, components.getComponent(2));
+    EXPECT_EQ((std::vector<uint32_t>{1, 0}), toVector(components.getComponentDependencies(2)));
+    EXPECT_EQ((std::vector<uint32_t>{0}), toVector(components.getComponentDependencies(1)));
+    EXPECT_TRUE(components.getComponentDependencies(0).empty());
+    for (uint32_t targetIndex = 0; targetIndex < 3; targetIndex++) {
+        EXPECT_FALSE(components.isTargetInCycle(targetIndex));
+        EXPECT_EQ((std::vector<uint32_t>{targetIndex}), toVector(components.getComponentTargets(components.getComponent(targetIndex))));
+    }
+}
+
+TEST(CmagDependencyComponentsTest, givenCyclesWhenDerivingComponentsThenCollapseThemAndMergeTheirEdges) {
+    // 0 -> 1 -> 2 -> 0 is a cycle, 1 -> 3, 2 -> 3, 3 -> 4 (interface), 4 -> 3 (interface)
+    const CmagDependencyGraph graph = createGraph({
+        {{1, CmagDependencyType::Build}},
+        {{2, CmagDependencyType::Build}, {3, CmagDependencyType::Build}},
+        {{0, CmagDependencyType::Build}, {3, CmagDependencyType::Build}},
+        {{4, CmagDependencyType::Interface}},
+        {{3, CmagDependencyType::Interface}},
+    });
+
+    CmagDependencyComponents buildComponents{graph, CmagDependencyType::Build};
+    ASSERT_EQ(3u, buildComponents.getComponentsCount());
+    const uint32_t cycle = buildComponents.getComponent(0);
+    EXPECT_EQ(cycle, buildComponents.getComponent(1));
+    EXPECT_EQ(cycle, buildComponents.getComponent(2));
+    EXPECT_TRUE(buildComponents.isComponentCyclic(cycle));
+    EXPECT_FALSE(buildComponents.isTargetInCycle(3));
+    EXPECT_FALSE(buildComponents.isTargetInCycle(4));
+    EXPECT_EQ(3u, buildComponents.getComponentTargets(cycle).size());
+    EXPECT_EQ((std::vector<uint32_t>{buildComponents.getComponent(3)}), toVector(buildComponents.getComponentDependencies(cycle)));
+
+    CmagDependencyComponents allComponents{graph, CmagDependencyType::Build | CmagDependencyType::Interface};
+    ASSERT_EQ(2u, allComponents.getComponentsCount());
+    EXPECT_EQ(allComponents.getComponent(3), allComponents.getComponent(4));
+    EXPECT_TRUE(allComponents.isTargetInCycle(3));
+    EXPECT_TRUE(allComponents.isTargetInCycle(4));
+}
+
+TEST(CmagDependencyComponentsTest, givenLongChainWhenDerivingComponentsThenDoNotOverflowStack) {
+    constexpr size_t targetsCount = 200000;
+    std::vector<std::vector<Edge>> edges(targetsCount);
+    for (size_t targetIndex = 0; targetIndex + 1 < targetsCount; targetIndex++) {
+        edges[targetIndex].push_back(Edge{static_cast<uint32_t>(targetIndex + 1), CmagDependencyType::Build});
+    }
+    edges.back().push_back(Edge{0, CmagDependencyType::Build});
+    const CmagDependencyGraph graph = createGraph(std::move(edges));
+
+    CmagDependencyComponents components{graph, CmagDependencyType::Build};
+    EXPECT_EQ(1u, components.getComponentsCount());
+    EXPECT_TRUE(components.isTargetInCycle(targetsCount / 2));
+}
+
+TEST(CmagDependencyComponentsTest, givenProjectWithCycleWhenGettingComponentsThenExposeCycleMembership) {
+    CmagProject project = {};
+    project.getGlobals().listDirs = {CmagListDir{"a", {}}};
+    auto createTarget = [](const char *name, const char *linkLibs) {
+        CmagTarget target = {};
+        target.name = name;
+        target.type = CmagTargetType::StaticLibrary;
+        target.configs = {{"Debug", {{"LINK_LIBRARIES", linkLibs}}}};
+        target.listDirName = "a";
+        return target;
+    };
+    EXPECT_TRUE(project.addTarget(createTarget("A", "B")));
+    EXPECT_TRUE(project.addTarget(createTarget("B", "C")));
+    EXPECT_TRUE(project.addTarget(createTarget("C", "B")));
+    ASSERT_TRUE(project.deriveData());
+
+    const CmagDependencyComponents *components = project.getDependencyComponents("Debug", CmagDependencyType::Build);
+    ASSERT_NE(nullptr, components);
+    EXPECT_EQ(components, project.getDependencyComponents("Debug", CmagDependencyType::Build));
+    EXPECT_FALSE(components->isTargetInCycle(0));
+    EXPECT_TRUE(components->isTargetInCycle(1));
+    EXPECT_TRUE(components->isTargetInCycle(2));
+    EXPECT_EQ(nullptr, project.getDependencyComponents("Release", CmagDependencyType::Build));
+
+    const CmagDependencyComponents *interfaceComponents = project.getDependencyComponents("Debug", CmagDependencyType::Interface);
+    ASSERT_NE(nullptr, interfaceComponents);
+    EXPECT_FALSE(interfaceComponents->isTargetInCycle(1));
+}
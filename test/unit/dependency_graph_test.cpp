@@ -0,0 +1,167 @@
+#include "cmag_core/core/dependency_graph.h"
+
+#include <gtest/gtest.h>
+
+using Edge = CmagDependencyGraph::Edge;
+using EdgeList = std::vector<std::pair<uint32_t, CmagDependencyType>>;
+
+static EdgeList toList(const CmagDependencyGraph::EdgeRange &edges) {
+    EdgeList result = {};
+    for (const Edge &edge : edges) {
+        result.emplace_back(edge.targetIndex, edge.types);
+    }
+    return result;
+}
+
+TEST(CmagDependencyGraphTest, givenNoTargetsWhenBuildingGraphThenItIsEmpty) {
+    CmagDependencyGraph graph = {};
+    graph.finalize();
+    EXPECT_EQ(0u, graph.getTargetsCount());
+    EXPECT_EQ(0u, graph.getEdgesCount());
+}
+
+TEST(CmagDependencyGraphTest, givenTargetsWhenBuildingGraphThenDependenciesAndDependentsAreSorted) {
+    CmagDependencyGraph graph = {};
+    std::vector<Edge> edges = {{2, CmagDependencyType::Build}, {1, CmagDependencyType::Interface}};
+    graph.addTarget(edges);
+    edges = {};
+    graph.addTarget(edges);
+    edges = {{1, CmagDependencyType::Additional}};
+    graph.addTarget(edges);
+    graph.finalize();
+
+    ASSERT_EQ(3u, graph.getTargetsCount());
+    EXPECT_EQ(3u, graph.getEdgesCount());
+    EXPECT_EQ((EdgeList{{1, CmagDependencyType::Interface}, {2, CmagDependencyType::Build}}), toList(graph.getDependencies(0)));
+    EXPECT_EQ((EdgeList{}), toList(graph.getDependencies(1)));
+    EXPECT_EQ((EdgeList{{1, CmagDependencyType::Additional}}), toList(graph.getDependencies(2)));
+
+    EXPECT_EQ((EdgeList{}), toList(graph.getDependents(0)));
+    EXPECT_EQ((EdgeList{{0, CmagDependencyType::Interface}, {2, CmagDependencyType::Additional}}), toList(graph.getDependents(1)));
+    EXPECT_EQ((EdgeList{{0, CmagDependencyType::Build}}), toList(graph.getDependents(2)));
+}
+
+TEST(CmagDependencyGraphTest, givenDuplicatedDependenciesWhenBuildingGraphThenMergeTheirTypes) {
+    CmagDependencyGraph graph = {};
+    std::vector<Edge> edges = {
+        {1, CmagDependencyType::Build},
+        {1, CmagDependencyType::Interface},
+        {1, CmagDependencyType::Build},
+    };
+    graph.addTarget(edges);
+    edges = {};
+    graph.addTarget(edges);
+    graph.finalize();
+
+    const CmagDependencyType expectedTypes = CmagDependencyType::Build | CmagDependencyType::Interface;
+    EXPECT_EQ(1u, graph.getEdgesCount());
+    EXPECT_EQ((EdgeList{{1, expectedTypes}}), toList(graph.getDependencies(0)));
+    EXPECT_EQ((EdgeList{{0, expectedTypes}}), toList(graph.getDependents(1)));
+}
+
+TEST(CmagDependencyGraphTest, givenClearedGraphWhenBuildingAgainThenOldEdgesAreGone) {
+    CmagDependencyGraph graph = {};
+    std::vector<Edge> edges = {{0, CmagDependencyType::Build}};
+    graph.addTarget(edges);
+    graph.finalize();
+    EXPECT_EQ(1u, graph.getEdgesCount());
+
+    graph.clear();
+    edges = {};
+    graph.addTarget(edges);
+    graph.finalize();
+    EXPECT_EQ(1u, graph.getTargetsCount());
+    EXPECT_EQ(0u, graph.getEdgesCount());
+    EXPECT_TRUE(graph.getDependencies(0).empty());
+    EXPECT_TRUE(graph.getDependents(0).empty());
+}
+
+TEST(CmagDependencyGraphTest, givenReplacedTargetWhenPatchingGraphThenReturnChangedTypesAndKeepOtherTargets) {
+    CmagDependencyGraph graph = {};
+    std::vector<std::vector<Edge>> edges = {
+        {{1, CmagDependencyType::Build}, {2, CmagDependencyType::Interface}},
+        {{2, CmagDependencyType::Build}},
+        {},
+    };
+    for (std::vector<Edge> &targetEdges : edges) {
+        graph.addTarget(targetEdges);
+    }
+    graph.finalize();
+
+    std::vector<Edge> newEdges = {{2, CmagDependencyType::Interface}, {1, CmagDependencyType::Build}};
+    EXPECT_EQ(CmagDependencyType::NONE, graph.replaceTarget(0, newEdges));
+
+    newEdges = {{2, CmagDependencyType::Build}, {1, CmagDependencyType::Additional}, {2, CmagDependencyType::Interface}};
+    EXPECT_EQ(CmagDependencyType::Build | CmagDependencyType::Additional, graph.replaceTarget(0, newEdges));
+    newEdges = {{0, CmagDependencyType::Interface}, {2, CmagDependencyType::Build}};
+    EXPECT_EQ(CmagDependencyType::Interface, graph.replaceTarget(1, newEdges));
+    graph.finalize();
+
+    EXPECT_EQ(4u, graph.getEdgesCount());
+    EXPECT_EQ((EdgeList{{1, CmagDependencyType::Additional}, {2, CmagDependencyType::Build | CmagDependencyType::Interface}}), toList(graph.getDependencies(0)));
+    EXPECT_EQ((EdgeList{{0, CmagDependencyType::Interface}, {2, CmagDependencyType::Build}}), toList(graph.getDependencies(1)));
+    EXPECT_EQ((EdgeList{}), toList(graph.getDependencies(2)));
+    EXPECT_EQ((EdgeList{{1, CmagDependencyType::Interface}}), toList(graph.getDependents(0)));
+    EXPECT_EQ((EdgeList{{0, CmagDependencyType::Build | CmagDependencyType::Interface}, {1, CmagDependencyType::Build}}), toList(graph.getDependents(2)));
+
+    newEdges = {};
+    EXPECT_EQ(CmagDependencyType::Additional | CmagDependencyType::Build | CmagDependencyType::Interface, graph.replaceTarget(0, newEdges));
+    graph.finalize();
+    EXPECT_EQ(2u, graph.getEdgesCount());
+    EXPECT_TRUE(graph.getDependencies(0).empty());
+    EXPECT_EQ((EdgeList{{0, CmagDependencyType::Interface}, {2, CmagDependencyType::Build}}), toList(graph.getDependencies(1)));
+}
+
+TEST(CmagDependencyGraphTest, givenDependencyTypesWhenQueryingDependentsThenFollowOnlyMatchingEdges) {
+    // 1 -> 0 (build), 2 -> 0 (interface), 3 -> 1 (build), 4 -> 3 (manual), 4 -> 2 (build)
+    CmagDependencyGraph graph = {};
+    std::vector<std::vector<Edge>> edges = {
+        {},
+        {{0, CmagDependencyType::Build}},
+        {{0, CmagDependencyType::Interface}},
+        {{1, CmagDependencyType::Build}},
+        {{3, CmagDependencyType::Additional}, {2, CmagDependencyType::Build}},
+    };
+    for (std::vector<Edge> &targetEdges : edges) {
+        graph.addTarget(targetEdges);
+    }
+    graph.finalize();
+
+    std::vector<uint32_t> result = {};
+    graph.collectDependents(0, CmagDependencyType::Build, result);
+    EXPECT_EQ((std::vector<uint32_t>{1}), result);
+    graph.collectDependents(0, CmagDependencyType::Build | CmagDependencyType::Interface, result);
+    EXPECT_EQ((std::vector<uint32_t>{1, 2}), result);
+    graph.collectDependents(4, CmagDependencyType::Build, result);
+    EXPECT_TRUE(result.empty());
+
+    graph.collectTransitiveDependents(0, CmagDependencyType::Build, result);
+    EXPECT_EQ((std::vector<uint32_t>{1, 3}), result);
+    graph.collectTransitiveDependents(0, CmagDependencyType::Build | CmagDependencyType::Additional, result);
+    EXPECT_EQ((std::vector<uint32_t>{1, 3, 4}), result);
+    graph.collectTransitiveDependents(0, CmagDependencyType::Build | CmagDependencyType::Interface | CmagDependencyType::Additional, result);
+    EXPECT_EQ((std::vector<uint32_t>{1, 2, 3, 4}), result);
+
+    EXPECT_TRUE(graph.hasDependents(0, CmagDependencyType::Interface));
+    EXPECT_FALSE(graph.hasDependents(0, CmagDependencyType::Additional));
+    EXPECT_TRUE(graph.hasDependents(3, CmagDependencyType::Additional));
+    EXPECT_FALSE(graph.hasDependents(4, CmagDependencyType::DEFAULT));
+}
+
+TEST(CmagDependencyGraphTest, givenCycleWhenQueryingTransitiveDependentsThenVisitEachTargetOnce) {
+    // 0 -> 1 -> 2 -> 0
+    CmagDependencyGraph graph = {};
+    std::vector<std::vector<Edge>> edges = {
+        {{1, CmagDependencyType::Build}},
+        {{2, CmagDependencyType::Build}},
+        {{0, CmagDependencyType::Build}},
+    };
+    for (std::vector<Edge> &targetEdges : edges) {
+        graph.addTarget(targetEdges);
+    }
+    graph.finalize();
+
+    std::vector<uint32_t> result = {};
+    graph.collectTransitiveDependents(0, CmagDependencyType::Build, result);
+    EXPECT_EQ((std::vector<uint32_t>{2, 1, 0}), result);
+}
@@ -0,0 +1,149 @@
+#include "cmag_core/core/cmag_project.h"
+#include "cmag_core/core/dependency_reachability.h"
+
+#include <gtest/gtest.h>
+
+using Edge = CmagDependencyGraph::Edge;
+
+static CmagDependencyGraph createGraph(std::vector<std::vector<Edge>> edges) {
+    CmagDependencyGraph graph = {};
+    for (std::vector<Edge> &targetEdges : edges) {
+        graph.addTarget(targetEdges);
+    }
+    graph.finalize();
+    return graph;
+}
+
+TEST(CmagDependencyReachabilityTest, givenDagWhenQueryingThenReturnTransitiveDependencies) {
+    // 0 -> 1 -> 2 -> 3, 0 -> 4 (interface), 5 is isolated
+    const CmagDependencyGraph graph = createGraph({
+        {{1, CmagDependencyType::Build}, {4, CmagDependencyType::Interface}},
+        {{2, CmagDependencyType::Build}},
+        {{3, CmagDependencyType::Build}},
+        {},
+        {},
+        {},
+    });
+
+    CmagDependencyReachability reachability{graph, CmagDependencyType::Build};
+    EXPECT_TRUE(reachability.hasBitsets());
+    EXPECT_EQ(6u, reachability.getComponents().getComponentsCount());
+    EXPECT_TRUE(reachability.dependsOn(0, 1));
+    EXPECT_TRUE(reachability.dependsOn(0, 3));
+    EXPECT_TRUE(reachability.dependsOn(1, 3));
+    EXPECT_FALSE(reachability.dependsOn(3, 0));
+    EXPECT_FALSE(reachability.dependsOn(0, 0));
+    EXPECT_FALSE(reachability.dependsOn(0, 4));
+    EXPECT_FALSE(reachability.dependsOn(5, 3));
+
+    std::vector<uint32_t> result = {};
+    reachability.collectDependencies(0, result);
+    EXPECT_EQ((std::vector<uint32_t>{1, 2, 3}), result);
+    reachability.collectDependencies(5, result);
+    EXPECT_TRUE(result.empty());
+
+    CmagDependencyReachability reachabilityWithInterface{graph, CmagDependencyType::Build | CmagDependencyType::Interface};
+    EXPECT_TRUE(reachabilityWithInterface.dependsOn(0, 4));
+    reachabilityWithInterface.collectDependencies(0, result);
+    EXPECT_EQ((std::vector<uint32_t>{1, 2, 3, 4}), result);
+}
+
+TEST(CmagDependencyReachabilityTest, givenCyclesWhenQueryingThenCollapseThemToComponents) {
+    // 0 -> 1 -> 2 -> 1, 2 -> 3, 4 -> 4
+    const CmagDependencyGraph graph = createGraph({
+        {{1, CmagDependencyType::Build}},
+        {{2, CmagDependencyType::Build}},
+        {{1, CmagDependencyType::Build}, {3, CmagDependencyType::Build}},
+        {},
+        {{4, CmagDependencyType::Build}},
+    });
+
+    CmagDependencyReachability reachability{graph, CmagDependencyType::Build};
+    const CmagDependencyComponents &components = reachability.getComponents();
+    EXPECT_EQ(4u, components.getComponentsCount());
+    EXPECT_EQ(components.getComponent(1), components.getComponent(2));
+    EXPECT_TRUE(components.isTargetInCycle(1));
+    EXPECT_TRUE(components.isTargetInCycle(4));
+    EXPECT_FALSE(components.isTargetInCycle(0));
+    EXPECT_FALSE(components.isTargetInCycle(3));
+
+    EXPECT_TRUE(reachability.dependsOn(1, 1));
+    EXPECT_TRUE(reachability.dependsOn(1, 2));
+    EXPECT_TRUE(reachability.dependsOn(2, 1));
+    EXPECT_TRUE(reachability.dependsOn(4, 4));
+    EXPECT_FALSE(reachability.dependsOn(3, 3));
+    EXPECT_FALSE(reachability.dependsOn(1, 0));
+
+    std::vector<uint32_t> result = {};
+    reachability.collectDependencies(0, result);
+    EXPECT_EQ((std::vector<uint32_t>{1, 2, 3}), result);
+    reachability.collectDependencies(2, result);
+    EXPECT_EQ((std::vector<uint32_t>{1, 2, 3}), result);
+    reachability.collectDependencies(4, result);
+    EXPECT_EQ((std::vector<uint32_t>{4}), result);
+}
+
+TEST(CmagDependencyReachabilityTest, givenGraphTooBigForBitsetsWhenQueryingThenResultsAreTheSame) {
+    // Chain of targets with a cycle at the end. The condensed graph is walked when bitsets are not used.
+    constexpr size_t targetsCount = 30000;
+    std::vector<std::vector<Edge>> edges(targetsCount);
+    for (size_t targetIndex = 0; targetIndex + 1 < targetsCount; targetIndex++) {
+        edges[targetIndex].push_back(Edge{static_cast<uint32_t>(targetIndex + 1), CmagDependencyType::Build});
+    }
+    edges.back().push_back(Edge{static_cast<uint32_t>(targetsCount - 2), CmagDependencyType::Build});
+    const CmagDependencyGraph graph = createGraph(std::move(edges));
+
+    CmagDependencyReachability reachability{graph, CmagDependencyType::Build};
+    ASSERT_FALSE(reachability.hasBitsets());
+    EXPECT_EQ(targetsCount - 1, reachability.getComponents().getComponentsCount());
+    EXPECT_TRUE(reachability.dependsOn(0, targetsCount - 1));
+    EXPECT_TRUE(reachability.dependsOn(targetsCount - 1, targetsCount - 2));
+    EXPECT_TRUE(reachability.dependsOn(targetsCount - 1, targetsCount - 1));
+    EXPECT_FALSE(reachability.dependsOn(100, 100));
+    EXPECT_FALSE(reachability.dependsOn(101, 100));
+
+    std::vector<uint32_t> result = {};
+    reachability.collectDependencies(targetsCount - 5, result);
+    EXPECT_EQ((std::vector<uint32_t>{targetsCount - 4, targetsCount - 3, targetsCount - 2, targetsCount - 1}), result);
+
+    // Walks reuse scratch memory, so earlier queries must not affect later ones.
+    EXPECT_TRUE(reachability.dependsOn(targetsCount - 5, targetsCount - 1));
+    EXPECT_FALSE(reachability.dependsOn(targetsCount - 1, targetsCount - 5));
+    EXPECT_TRUE(reachability.dependsOn(0, 1));
+    reachability.collectDependencies(targetsCount - 3, result);
+    EXPECT_EQ((std::vector<uint32_t>{targetsCount - 2, targetsCount - 1}), result);
+}
+
+TEST(CmagDependencyReachabilityTest, givenProjectWhenGettingReachabilityThenCacheItUntilNextDerivation) {
+    CmagProject project = {};
+    project.getGlobals().listDirs = {CmagListDir{"a", {}}};
+    auto createTarget = [](const char *name, const char *linkLibs) {
+        CmagTarget target = {};
+        target.name = name;
+        target.type = CmagTargetType::Executable;
+        target.configs = {{"Debug", {{"LINK_LIBRARIES", linkLibs}}}};
+        target.listDirName = "a";
+        return target;
+    };
+    EXPECT_TRUE(project.addTarget(createTarget("A", "B")));
+    EXPECT_TRUE(project.addTarget(createTarget("B", "C")));
+    EXPECT_TRUE(project.addTarget(createTarget("C", "")));
+    EXPECT_EQ(nullptr, project.getDependencyReachability("Debug", CmagDependencyType::Build));
+    ASSERT_TRUE(project.deriveData());
+
+    const CmagDependencyReachability *reachability = project.getDependencyReachability("Debug", CmagDependencyType::Build);
+    ASSERT_NE(nullptr, reachability);
+    EXPECT_EQ(CmagDependencyType::Build, reachability->getTypes());
+    EXPECT_TRUE(reachability->dependsOn(0, 2));
+    EXPECT_EQ(&reachability->getComponents(), project.getDependencyComponents("Debug", CmagDependencyType::Build));
+    EXPECT_EQ(reachability, project.getDependencyReachability("Debug", CmagDependencyType::Build));
+    EXPECT_NE(reachability, project.getDependencyReachability("Debug", CmagDependencyType::DEFAULT));
+    EXPECT_EQ(nullptr, project.getDependencyReachability("Release", CmagDependencyType::Build));
+
+    EXPECT_TRUE(project.replaceTargetConfigs("B", {{"Debug", {{"LINK_LIBRARIES", ""}}}}));
+    ASSERT_TRUE(project.deriveDirtyData());
+    reachability = project.getDependencyReachability("Debug", CmagDependencyType::Build);
+    ASSERT_NE(nullptr, reachability);
+    EXPECT_TRUE(reachability->dependsOn(0, 1));
+    EXPECT_FALSE(reachability->dependsOn(0, 2));
+}
@@ -291,3 +291,35 @@ TEST(DumperArgumentParserTest, givenMakeFindPackageGlobalArgumentThenItIsParsedC
         EXPECT_TRUE(parser.getMakeFindPackageGlobal());
     }
 }
+
+TEST(DumperArgumentParserTest, givenBinaryProjectArgumentThenItIsParsedCorrectly) {
+    {
+        const char *argv[] = {"cmag", "cmake", ".."};
+        const int argc = sizeof(argv) / sizeof(argv[0]);
+        DumperArgumentParser parser{argc, argv};
+        EXPECT_TRUE(parser.isValid());
+        EXPECT_FALSE(parser.getBinaryProject());
+    }
+    {
+        const char *argv[] = {"cmag", "-b", "cmake", ".."};
+        const int argc = sizeof(argv) / sizeof(argv[0]);
+        DumperArgumentParser parser{argc, argv};
+        EXPECT_TRUE(parser.isValid());
+        EXPECT_TRUE(parser.getBinaryProject());
+    }
+}
+
+TEST(DumperArgumentParserTest, givenConvertArgumentWithoutCmakeCommandThenArgumentsAreValid) {
+    const char *argv[] = {"cmag", "-c", "build/project.cmag-project"};
+    const int argc = sizeof(argv) / sizeof(argv[0]);
+    DumperArgumentParser parser{argc, argv};
+    EXPECT_TRUE(parser.isValid());
+    EXPECT_STREQ("build/project.cmag-project", parser.getConvertPath().string().c_str());
+}
+
+TEST(DumperArgumentParserTest, givenConvertArgumentWithoutValueThenArgumentsAreInvalid) {
+    const char *argv[] = {"cmag", "-c"};
+    const int argc = sizeof(argv) / sizeof(argv[0]);
+    DumperArgumentParser parser{argc, argv};
+    EXPECT_FALSE(parser.isValid());
+}
@@ -0,0 +1,104 @@
+#include "cmag_core/core/genex.h"
+
+#include <gtest/gtest.h>
+
+struct CmagGenexTreeTest : ::testing::Test {
+    // Prints the tree in a form, which is easy to compare. Genexes are printed as G(name|param|param...), list
+    // separators as S and texts as they are.
+    static std::string print(const CmagGenexTree &tree, const CmagGenexSequence &sequence) {
+        std::string result = {};
+        for (size_t nodeIndex = 0; nodeIndex < sequence.nodesCount; nodeIndex++) {
+            const CmagGenexNode &node = tree.getNode(sequence, nodeIndex);
+            switch (node.type) {
+            case CmagGenexNodeType::Text:
+                result += tree.getText(node);
+                break;
+            case CmagGenexNodeType::ListSeparator:
+                result += "S";
+                break;
+            case CmagGenexNodeType::Genex:
+                result += "G(";
+                result += printName(tree, node);
+                for (size_t parameterIndex = 0; parameterIndex < tree.getGenexParametersCount(node); parameterIndex++) {
+                    result += "|";
+                    result += print(tree, tree.getGenexParameter(node, parameterIndex));
+                }
+                result += ")";
+                break;
+            }
+        }
+        return result;
+    }
+
+    static std::string printName(const CmagGenexTree &tree, const CmagGenexNode &node) {
+        const std::string_view name = tree.getGenexName(node);
+        return name.empty() ? "<complex>" : std::string{name};
+    }
+
+    static std::string parse(std::string_view value) {
+        CmagGenexTree tree{value, std::pmr::get_default_resource()};
+        EXPECT_TRUE(tree.isValid());
+        return print(tree, tree.getRoot());
+    }
+};
+
+TEST_F(CmagGenexTreeTest, givenTextWithoutGenexesWhenParsingThenReturnTextsAndSeparators) {
+    EXPECT_EQ("", parse(""));
+    EXPECT_EQ("Lib1", parse("Lib1"));
+    EXPECT_EQ("Lib1SLib2SSLib3", parse("Lib1;Lib2;;Lib3"));
+    EXPECT_EQ("Lib1\\;Lib2", parse("Lib1\\;Lib2"));
+    EXPECT_EQ("a>b:c,d", parse("a>b:c,d"));
+}
+
+TEST_F(CmagGenexTreeTest, givenGenexesWhenParsingThenReturnNamesAndParameters) {
+    EXPECT_EQ("G(CONFIG)", parse("$<CONFIG>"));
+    EXPECT_EQ("G(LINK_ONLY|Lib1)SLib2", parse("$<LINK_ONLY:Lib1>;Lib2"));
+    EXPECT_EQ("G(LINK_ONLY|)", parse("$<LINK_ONLY:>"));
+    EXPECT_EQ("G(IF|a|b;c|d:e)", parse("$<IF:a,b;c,d:e>"));
+    EXPECT_EQ("xG(1|y)z", parse("x$<1:y>z"));
+}
+
+TEST_F(CmagGenexTreeTest, givenNestedGenexesWhenParsingThenReturnNestedNodes) {
+    EXPECT_EQ("G(LINK_ONLY|LibG(CONFIG))", parse("$<LINK_ONLY:Lib$<CONFIG>>"));
+    EXPECT_EQ("G(<complex>|LibDebug)", parse("$<$<CONFIG:Debug>:LibDebug>"));
+    EXPECT_EQ("G(LINK_ONLY|G(<complex>|a|b))", parse("$<LINK_ONLY:$<$<CONFIG:Debug>:a,b>>"));
+}
+
+TEST_F(CmagGenexTreeTest, givenEscapeGenexesWhenParsingThenTheyDoNotEndOrSplitAnything) {
+    EXPECT_EQ("G(LINK_ONLY|aG(ANGLE-R)b)", parse("$<LINK_ONLY:a$<ANGLE-R>b>"));
+    EXPECT_EQ("G(LINK_ONLY|aG(SEMICOLON)b)Sc", parse("$<LINK_ONLY:a$<SEMICOLON>b>;c"));
+    EXPECT_EQ("G(1|aG(COMMA)b)", parse("$<1:a$<COMMA>b>"));
+}
+
+TEST_F(CmagGenexTreeTest, givenUnclosedGenexWhenParsingThenTreeIsInvalid) {
+    for (std::string_view value : {"$<", "$<CONFIG", "$<LINK_ONLY:a", "a;$<1:$<CONFIG>", "$<1:$<CONFIG>b;c"}) {
+        CmagGenexTree tree{value, std::pmr::get_default_resource()};
+        EXPECT_FALSE(tree.isValid()) << value;
+    }
+}
+
+TEST_F(CmagGenexTreeTest, givenGenexWhenParsingThenNodeOffsetsPointToTheValue) {
+    const std::string_view value = "a;$<1:$<CONFIG>>";
+    CmagGenexTree tree{value, std::pmr::get_default_resource()};
+    ASSERT_EQ(3u, tree.getRoot().nodesCount);
+
+    const CmagGenexNode &genex = tree.getNode(tree.getRoot(), 2);
+    EXPECT_EQ("$<1:$<CONFIG>>", tree.getText(genex));
+    ASSERT_EQ(1u, tree.getGenexParametersCount(genex));
+    EXPECT_EQ("$<CONFIG>", tree.getText(tree.getNode(tree.getGenexParameter(genex, 0), 0)));
+}
+
+TEST(CmagGenexCacheTest, givenSameValuesWhenParsingThenReturnTheSameTree) {
+    CmagGenexCache cache{};
+    std::string value = "$<LINK_ONLY:Lib1>;Lib2";
+    const CmagGenexTree &tree1 = cache.parse(value);
+    const CmagGenexTree &tree2 = cache.parse("Lib3");
+    value[0] = 'x'; // cache has its own copy
+    const CmagGenexTree &tree3 = cache.parse("$<LINK_ONLY:Lib1>;Lib2");
+
+    EXPECT_EQ(&tree1, &tree3);
+    EXPECT_NE(&tree1, &tree2);
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_EQ("$<LINK_ONLY:Lib1>;Lib2", tree1.getValue());
+    EXPECT_EQ(3u, tree1.getRoot().nodesCount);
+}
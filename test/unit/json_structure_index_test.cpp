@@ -0,0 +1,98 @@
+#include "cmag_core/parse/json_structure_index.h"
+
+#include <gtest/gtest.h>
+
+using Member = CmagJsonStructureIndex::Member;
+
+static std::vector<std::pair<std::string_view, std::string_view>> toPairs(const std::vector<Member> &members) {
+    std::vector<std::pair<std::string_view, std::string_view>> result = {};
+    for (const Member &member : members) {
+        result.emplace_back(member.key, member.value);
+    }
+    return result;
+}
+
+TEST(CmagJsonStructureIndexTest, givenObjectWhenCollectingMembersThenReturnKeysAndValues) {
+    const char *json = R"DELIMETER(
+    {
+        "a" : 1,
+        "b": { "c": [1, {"d": 2}], "e": {} },
+        "f" :"text",
+        "g": []
+    }
+    )DELIMETER";
+
+    CmagJsonStructureIndex index = {};
+    ASSERT_TRUE(index.build(json));
+    std::vector<Member> members = {};
+    ASSERT_TRUE(index.collectRootMembers(members));
+    using Pairs = std::vector<std::pair<std::string_view, std::string_view>>;
+    EXPECT_EQ((Pairs{
+                  {"\"a\"", "1"},
+                  {"\"b\"", R"({ "c": [1, {"d": 2}], "e": {} })"},
+                  {"\"f\"", "\"text\""},
+                  {"\"g\"", "[]"},
+              }),
+              toPairs(members));
+    EXPECT_FALSE(index.isObject(members[0].valueStructuralIndex));
+    EXPECT_FALSE(index.isObject(members[3].valueStructuralIndex));
+
+    ASSERT_TRUE(index.isObject(members[1].valueStructuralIndex));
+    std::vector<Member> nestedMembers = {};
+    ASSERT_TRUE(index.collectObjectMembers(members[1].valueStructuralIndex, nestedMembers));
+    EXPECT_EQ((Pairs{{"\"c\"", R"([1, {"d": 2}])"}, {"\"e\"", "{}"}}), toPairs(nestedMembers));
+}
+
+TEST(CmagJsonStructureIndexTest, givenStringsWithStructuralCharactersWhenBuildingIndexThenIgnoreThem) {
+    const char *json = R"DELIMETER({
+        "a{": "}],:\"\\",
+        '''b"''': '''c ' {'' " \'''
+    })DELIMETER";
+
+    CmagJsonStructureIndex index = {};
+    ASSERT_TRUE(index.build(json));
+    std::vector<Member> members = {};
+    ASSERT_TRUE(index.collectRootMembers(members));
+    using Pairs = std::vector<std::pair<std::string_view, std::string_view>>;
+    EXPECT_EQ((Pairs{{R"("a{")", R"("}],:\"\\")"}, {R"('''b"''')", R"('''c ' {'' " \''')"}}), toPairs(members));
+}
+
+TEST(CmagJsonStructureIndexTest, givenEmptyObjectWhenCollectingMembersThenReturnNoMembers) {
+    CmagJsonStructureIndex index = {};
+    ASSERT_TRUE(index.build(" { \n } "));
+    std::vector<Member> members = {{"a", "b"}};
+    EXPECT_TRUE(index.collectRootMembers(members));
+    EXPECT_TRUE(members.empty());
+}
+
+TEST(CmagJsonStructureIndexTest, givenUnterminatedStringsOrUnmatchedBracketsWhenBuildingIndexThenFail) {
+    CmagJsonStructureIndex index = {};
+    EXPECT_FALSE(index.build(R"({"a": "b})"));
+    EXPECT_FALSE(index.build(R"({"a": "b\"})"));
+    EXPECT_FALSE(index.build(R"({"a": '''b''})"));
+    EXPECT_FALSE(index.build(R"({"a": 'b'})"));
+    EXPECT_FALSE(index.build(R"({"a": [}])"));
+    EXPECT_FALSE(index.build(R"({"a": 1)"));
+    EXPECT_FALSE(index.build(R"({"a": 1}})"));
+}
+
+TEST(CmagJsonStructureIndexTest, givenInvalidObjectStructureWhenCollectingMembersThenFail) {
+    const char *invalidJsons[] = {
+        R"([1, 2])",
+        R"({"a": 1} {})",
+        R"(x {"a": 1})",
+        R"({"a": 1,})",
+        R"({"a" 1})",
+        R"({: 1})",
+        R"({"a": })",
+        R"({"a": 1 "b": 2})",
+        R"({"a": {} 1})",
+        R"({"a": 1: 2})",
+    };
+    for (const char *json : invalidJsons) {
+        CmagJsonStructureIndex index = {};
+        ASSERT_TRUE(index.build(json)) << json;
+        std::vector<Member> members = {};
+        EXPECT_FALSE(index.collectRootMembers(members)) << json;
+    }
+}
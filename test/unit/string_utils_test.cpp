@@ -120,4 +120,40 @@ TEST(CompareCMakeVersionsTest, givenShortVersionsThenCompareCorrectly) {
     EXPECT_EQ(0, compareCmakeVersions("3.10.0", "3.10"));
     EXPECT_EQ(0, compareCmakeVersions("3.0.0", "3"));
     EXPECT_GT(0, compareCmakeVersions("4.10.11", "3.10"));
-}
\ No newline at end of file
+}
+
+TEST(FindSubstringTest, givenPatternWhenSearchingThenReturnTheSameResultAsStdFind) {
+    const std::string_view value = "::@;::@(;::@(abc);::";
+    for (std::string_view pattern : {"::@(", ");", ";::@", ":", "", "::@(x", "::::::::::::::::::::::::"}) {
+        for (size_t offset = 0; offset <= value.size() + 1; offset++) {
+            EXPECT_EQ(value.find(pattern, offset), findSubstring(value, pattern, offset)) << pattern << " " << offset;
+        }
+    }
+}
+
+TEST(IterateCmakeListStringTest, givenPlainListThenReturnTheSameEntriesAsSplitting) {
+    for (std::string_view value : {"", "a", "a;b", ";", "a;;b;", "abc;def;ghi"}) {
+        for (bool ignoreSingleEntry : {false, true}) {
+            const StringSplitRange range = iterateCmakeListString(value, ignoreSingleEntry);
+            const std::vector<std::string_view> entries(range.begin(), range.end());
+            EXPECT_EQ(splitStringByChar(value, ignoreSingleEntry, ';'), entries) << value;
+            EXPECT_EQ(entries.empty(), range.empty());
+        }
+    }
+}
+
+TEST(IterateCmakeListStringTest, givenEscapedSemicolonsThenDoNotSplitThem) {
+    using List = std::vector<std::string_view>;
+    EXPECT_EQ((List{"a\\;b", "c"}), splitCmakeListString("a\\;b;c", false));
+    EXPECT_EQ((List{}), splitCmakeListString("a\\;b", true));
+    EXPECT_EQ((List{"a\\;", "b"}), splitCmakeListString("a\\;;b", false));
+    EXPECT_EQ((List{"a\\b", "c"}), splitCmakeListString("a\\b;c", false));
+}
+
+TEST(IterateCmakeListStringTest, givenSemicolonsInBracketsOrGenexesThenDoNotSplitThem) {
+    using List = std::vector<std::string_view>;
+    EXPECT_EQ((List{"[a;b]", "c"}), splitCmakeListString("[a;b];c", false));
+    EXPECT_EQ((List{"[[a;]b;c]", "d"}), splitCmakeListString("[[a;]b;c];d", false));
+    EXPECT_EQ((List{"$<$<CONFIG:Debug>:a;b>", "c"}), splitCmakeListString("$<$<CONFIG:Debug>:a;b>;c", false));
+    EXPECT_EQ((List{"a>", "b]", "c"}), splitCmakeListString("a>;b];c", false));
+}
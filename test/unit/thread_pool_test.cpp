@@ -0,0 +1,26 @@
+#include "cmag_core/utils/thread_pool.h"
+
+#include <atomic>
+#include <gtest/gtest.h>
+
+TEST(ThreadPoolTest, givenVariousThreadsCountsWhenCallingParallelForThenCallFunctionForEveryIndexOnce) {
+    for (size_t threadsCount : {1u, 2u, 5u}) {
+        ThreadPool threadPool{threadsCount};
+        EXPECT_EQ(threadsCount, threadPool.getThreadsCount());
+
+        for (size_t count : {0u, 1u, 3u, 1000u}) {
+            std::vector<std::atomic<size_t>> callsCounts(count);
+            threadPool.parallelFor(count, [&](size_t index) {
+                callsCounts[index]++;
+            });
+            for (size_t index = 0; index < count; index++) {
+                EXPECT_EQ(1u, callsCounts[index].load());
+            }
+        }
+    }
+}
+
+TEST(ThreadPoolTest, givenZeroThreadsWhenCreatingThreadPoolThenUseOneThread) {
+    ThreadPool threadPool{0};
+    EXPECT_EQ(1u, threadPool.getThreadsCount());
+}